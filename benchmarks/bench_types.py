@@ -2,9 +2,15 @@
 """
 Micro-benchmarks for tsrkit_types init/encode/decode + cProfile summaries.
 
+Each case also records its tracemalloc allocation peak, so memory
+regressions show up in the same JSON as time regressions. Pass
+--save-baseline to additionally write benchmarks/out/bench_baseline.json,
+which benchmarks/compare.py diffs new runs against.
+
 Usage:
   python benchmarks/bench_types.py
   python benchmarks/bench_types.py --runs 20000 --profile-runs 2000 --op-runs 20000
+  python benchmarks/bench_types.py --save-baseline
 """
 
 import argparse
@@ -14,6 +20,7 @@ import json
 import os
 import pstats
 import time
+import tracemalloc
 from dataclasses import dataclass
 from typing import Any, Callable, Dict, Iterable, List, Optional, Tuple, Type
 from array import array
@@ -278,6 +285,19 @@ def _timed_loop(runs: int, fn: Callable[[int], None]) -> float:
     return end - start
 
 
+def _traced_peak(runs: int, fn: Callable[[int], None]) -> int:
+    """Peak bytes allocated while running `fn` `runs` times (tracemalloc)."""
+    gc.collect()
+    tracemalloc.start()
+    try:
+        for i in range(runs):
+            fn(i)
+        _, peak = tracemalloc.get_traced_memory()
+    finally:
+        tracemalloc.stop()
+    return peak
+
+
 def _profile_loop(runs: int, fn: Callable[[int], None]) -> pstats.Stats:
     prof = cProfile.Profile()
     prof.enable()
@@ -1398,8 +1418,16 @@ def main() -> int:
     parser.add_argument("--runs", type=int, default=20000)
     parser.add_argument("--profile-runs", type=int, default=2000)
     parser.add_argument("--op-runs", type=int, default=20000)
+    parser.add_argument("--memory-runs", type=int, default=200)
     parser.add_argument("--profile", action="store_true", default=True)
     parser.add_argument("--no-profile", action="store_false", dest="profile")
+    parser.add_argument("--memory", action="store_true", default=True)
+    parser.add_argument("--no-memory", action="store_false", dest="memory")
+    parser.add_argument(
+        "--save-baseline",
+        action="store_true",
+        help="also write results to bench_baseline.json for compare.py",
+    )
     parser.add_argument("--output-dir", default=os.path.join("benchmarks", "out"))
     args = parser.parse_args()
 
@@ -1408,6 +1436,7 @@ def main() -> int:
     cases = _build_cases()
     results: Dict[str, Dict[str, float]] = {}
     profiles: Dict[str, Dict[str, List[Tuple[str, float, int]]]] = {}
+    memory: Dict[str, Dict[str, int]] = {}
 
     for case in cases:
         results[case.name] = {}
@@ -1427,6 +1456,9 @@ def main() -> int:
                 stats = _profile_loop(args.profile_runs, _init_loop)
                 profiles.setdefault(case.name, {})["init"] = _stats_top(stats)
 
+            if args.memory:
+                memory.setdefault(case.name, {})["init_peak_b"] = _traced_peak(args.memory_runs, _init_loop)
+
         if case.encode_values:
             vals = case.encode_values
             n = len(vals)
@@ -1446,6 +1478,9 @@ def main() -> int:
                 stats = _profile_loop(args.profile_runs, _encode_loop)
                 profiles.setdefault(case.name, {})["encode"] = _stats_top(stats)
 
+            if args.memory:
+                memory.setdefault(case.name, {})["encode_peak_b"] = _traced_peak(args.memory_runs, _encode_loop)
+
         if case.decode_fn and case.decode_buffers:
             bufs = case.decode_buffers
             n = len(bufs)
@@ -1460,6 +1495,9 @@ def main() -> int:
                 stats = _profile_loop(args.profile_runs, _decode_loop)
                 profiles.setdefault(case.name, {})["decode"] = _stats_top(stats)
 
+            if args.memory:
+                memory.setdefault(case.name, {})["decode_peak_b"] = _traced_peak(args.memory_runs, _decode_loop)
+
         if case.encode_values and case.ctor:
             vals = case.encode_values
             n = len(vals)
@@ -1483,6 +1521,9 @@ def main() -> int:
                     stats = _profile_loop(args.profile_runs, _json_encode_loop)
                     profiles.setdefault(case.name, {})["json_encode"] = _stats_top(stats)
 
+                if args.memory:
+                    memory.setdefault(case.name, {})["json_encode_peak_b"] = _traced_peak(args.memory_runs, _json_encode_loop)
+
                 json_decode_fn = case.json_decode_fn
                 if json_decode_fn is None and case.json_decode and hasattr(case.ctor, "from_json"):
                     json_decode_fn = case.ctor.from_json
@@ -1498,23 +1539,29 @@ def main() -> int:
                         stats = _profile_loop(args.profile_runs, _json_decode_loop)
                         profiles.setdefault(case.name, {})["json_decode"] = _stats_top(stats)
 
+                    if args.memory:
+                        memory.setdefault(case.name, {})["json_decode_peak_b"] = _traced_peak(args.memory_runs, _json_decode_loop)
+
     container_ops = _bench_container_ops(args.op_runs)
 
     # Write results to disk
+    payload = {
+        "runs": args.runs,
+        "profile_runs": args.profile_runs,
+        "op_runs": args.op_runs,
+        "memory_runs": args.memory_runs,
+        "results": results,
+        "container_ops": container_ops,
+        "memory": memory,
+    }
     results_path = os.path.join(args.output_dir, "bench_results.json")
     with open(results_path, "w", encoding="utf-8") as f:
-        json.dump(
-            {
-                "runs": args.runs,
-                "profile_runs": args.profile_runs,
-                "op_runs": args.op_runs,
-                "results": results,
-                "container_ops": container_ops,
-            },
-            f,
-            indent=2,
-            sort_keys=True,
-        )
+        json.dump(payload, f, indent=2, sort_keys=True)
+
+    if args.save_baseline:
+        baseline_path = os.path.join(args.output_dir, "bench_baseline.json")
+        with open(baseline_path, "w", encoding="utf-8") as f:
+            json.dump(payload, f, indent=2, sort_keys=True)
 
     if args.profile:
         profile_path = os.path.join(args.output_dir, "bench_profiles.json")
@@ -1544,6 +1591,12 @@ def main() -> int:
     for name, secs in container_ops.items():
         print("%s, %.6f" % (name, secs))
 
+    if memory:
+        print("Allocation peaks (bytes for %d runs):" % args.memory_runs)
+        for name, peaks in memory.items():
+            row = ", ".join("%s=%d" % (op, peak) for op, peak in sorted(peaks.items()))
+            print("%s, %s" % (name, row))
+
     return 0
 
 
@@ -1,10 +1,30 @@
 #!/usr/bin/env python3
-"""Compare two benchmark runs and show what got faster/slower."""
+"""
+Compare two benchmark runs and show what got faster/slower.
 
+Times are normalized per-run before comparing, so a baseline recorded with
+a different --runs count still diffs correctly. Allocation peaks (the
+"memory" section written by bench_types.py) are compared as-is. Exits
+non-zero when any regression crosses the fail thresholds, which is what
+lets CI gate on this script:
+
+  python benchmarks/bench_types.py
+  python benchmarks/compare.py benchmarks/out/bench_results.json \
+      --fail-threshold 20 --memory-fail-threshold 25
+"""
+
+import argparse
 import json
 import sys
 from pathlib import Path
 
+# Per-run times below this are dominated by timer noise; skip them.
+_MIN_SECONDS_PER_RUN = 1e-7
+
+# Allocation peaks below this are interpreter noise (free-list churn), not
+# a property of the codec; skip them.
+_MIN_PEAK_BYTES = 4096
+
 
 def load_results(path):
     """Load benchmark results from JSON file."""
@@ -12,54 +32,67 @@ def load_results(path):
         return json.load(f)
 
 
-def compare(current_path, baseline_path):
-    """Compare current results against baseline."""
+def _classify(name, base, curr, report_threshold, regressions, improvements):
+    """File a (base, curr) pair under regressions or improvements by ratio."""
+    if base == 0:
+        return
+    change = (curr / base - 1) * 100
+    if change >= report_threshold:
+        regressions.append((name, base, curr, change))
+    elif change <= -report_threshold:
+        improvements.append((name, base, curr, change))
+
+
+def compare(current_path, baseline_path, report_threshold, fail_threshold, memory_fail_threshold):
+    """Compare current results against baseline; returns a process exit code."""
     current = load_results(current_path)
     baseline = load_results(baseline_path)
 
-    # Extract results
-    curr_tests = current.get("results", {})
-    base_tests = baseline.get("results", {})
-    curr_ops = current.get("container_ops", {})
-    base_ops = baseline.get("container_ops", {})
+    curr_runs = current.get("runs", 1) or 1
+    base_runs = baseline.get("runs", 1) or 1
+    curr_op_runs = current.get("op_runs", 1) or 1
+    base_op_runs = baseline.get("op_runs", 1) or 1
 
     regressions = []
     improvements = []
+    mem_regressions = []
+    mem_improvements = []
 
-    # Compare test results
-    for name, ops in curr_tests.items():
+    # Compare test results (per-run seconds)
+    base_tests = baseline.get("results", {})
+    for name, ops in current.get("results", {}).items():
         if name not in base_tests:
             continue
         for op, curr_time in ops.items():
             if op not in base_tests[name]:
                 continue
-            base_time = base_tests[name][op]
-            if base_time == 0:
+            base_time = base_tests[name][op] / base_runs
+            curr_time = curr_time / curr_runs
+            if base_time < _MIN_SECONDS_PER_RUN:
                 continue
+            _classify(f"{name}.{op}", base_time, curr_time, report_threshold, regressions, improvements)
 
-            ratio = curr_time / base_time
-            change = (ratio - 1) * 100
-
-            if ratio >= 1.10:  # 10% slower
-                regressions.append((f"{name}.{op}", base_time, curr_time, change))
-            elif ratio <= 0.90:  # 10% faster
-                improvements.append((f"{name}.{op}", base_time, curr_time, change))
-
-    # Compare container ops
-    for name, curr_time in curr_ops.items():
+    # Compare container ops (per-run seconds)
+    base_ops = baseline.get("container_ops", {})
+    for name, curr_time in current.get("container_ops", {}).items():
         if name not in base_ops:
             continue
-        base_time = base_ops[name]
-        if base_time == 0:
+        base_time = base_ops[name] / base_op_runs
+        curr_time = curr_time / curr_op_runs
+        if base_time < _MIN_SECONDS_PER_RUN:
             continue
+        _classify(f"ops.{name}", base_time, curr_time, report_threshold, regressions, improvements)
 
-        ratio = curr_time / base_time
-        change = (ratio - 1) * 100
-
-        if ratio >= 1.10:
-            regressions.append((f"ops.{name}", base_time, curr_time, change))
-        elif ratio <= 0.90:
-            improvements.append((f"ops.{name}", base_time, curr_time, change))
+    # Compare allocation peaks (bytes)
+    base_mem = baseline.get("memory", {})
+    for name, peaks in current.get("memory", {}).items():
+        if name not in base_mem:
+            continue
+        for op, curr_peak in peaks.items():
+            base_peak = base_mem[name].get(op)
+            if base_peak is None or base_peak < _MIN_PEAK_BYTES:
+                continue
+            _classify(f"{name}.{op}", base_peak, curr_peak, report_threshold, mem_regressions, mem_improvements)
 
     # Print results
     print(f"\n{'='*70}")
@@ -67,48 +100,79 @@ def compare(current_path, baseline_path):
     print(f"{'='*70}")
     print(f"Baseline: {baseline_path}")
     print(f"Current:  {current_path}")
-    print(f"Runs:     {current.get('runs', 'N/A')}")
+    print(f"Runs:     {current.get('runs', 'N/A')} (baseline {baseline.get('runs', 'N/A')})")
     print(f"{'='*70}\n")
 
-    print(f"Summary: {len(improvements)} improvements, {len(regressions)} regressions\n")
+    print(
+        f"Summary: {len(improvements)} improvements, {len(regressions)} regressions, "
+        f"{len(mem_improvements)} memory improvements, {len(mem_regressions)} memory regressions\n"
+    )
 
-    if regressions:
-        regressions.sort(key=lambda x: x[3], reverse=True)  # Sort by % change
-        print(f"⚠️  REGRESSIONS (slower):")
+    def show(title, rows, fmt):
+        if not rows:
+            return
+        print(title)
         print(f"{'-'*70}")
-        for name, base, curr, change in regressions[:20]:  # Top 20
-            print(f"  {name:40} {base:.4f}s → {curr:.4f}s  ({change:+6.1f}%)")
-        if len(regressions) > 20:
-            print(f"  ... and {len(regressions) - 20} more")
+        for name, base, curr, change in rows[:20]:  # Top 20
+            print(f"  {name:40} {fmt(base)} → {fmt(curr)}  ({change:+6.1f}%)")
+        if len(rows) > 20:
+            print(f"  ... and {len(rows) - 20} more")
         print()
 
-    if improvements:
-        improvements.sort(key=lambda x: x[3])  # Sort by % change
-        print(f"✅ IMPROVEMENTS (faster):")
-        print(f"{'-'*70}")
-        for name, base, curr, change in improvements[:20]:  # Top 20
-            print(f"  {name:40} {base:.4f}s → {curr:.4f}s  ({change:+6.1f}%)")
-        if len(improvements) > 20:
-            print(f"  ... and {len(improvements) - 20} more")
-        print()
+    regressions.sort(key=lambda x: x[3], reverse=True)  # Sort by % change
+    improvements.sort(key=lambda x: x[3])
+    mem_regressions.sort(key=lambda x: x[3], reverse=True)
+    mem_improvements.sort(key=lambda x: x[3])
 
-    # Exit with error if major regressions (>20% slower)
-    major = [r for r in regressions if r[3] >= 20]
+    def time_fmt(v):
+        return f"{v * 1e6:.3f}us"
+
+    def mem_fmt(v):
+        return f"{v / 1024:.1f}KiB"
+
+    show("⚠️  REGRESSIONS (slower):", regressions, time_fmt)
+    show("✅ IMPROVEMENTS (faster):", improvements, time_fmt)
+    show("⚠️  MEMORY REGRESSIONS (larger peak):", mem_regressions, mem_fmt)
+    show("✅ MEMORY IMPROVEMENTS (smaller peak):", mem_improvements, mem_fmt)
+
+    # Exit with error if regressions cross the fail thresholds
+    major = [r for r in regressions if r[3] >= fail_threshold]
+    major_mem = [r for r in mem_regressions if r[3] >= memory_fail_threshold]
     if major:
-        print(f"❌ {len(major)} major regression(s) found (>20% slower)\n")
+        print(f"❌ {len(major)} major regression(s) found (>{fail_threshold:g}% slower)\n")
+    if major_mem:
+        print(f"❌ {len(major_mem)} major memory regression(s) found (>{memory_fail_threshold:g}% larger peak)\n")
+    if major or major_mem:
         return 1
 
     return 0
 
 
 def main():
-    if len(sys.argv) < 2:
-        print("Usage: python compare.py <current.json> [baseline.json]")
-        print("   If baseline.json not provided, uses benchmarks/out/bench_baseline.json")
-        sys.exit(1)
-
-    current_path = Path(sys.argv[1])
-    baseline_path = Path(sys.argv[2]) if len(sys.argv) > 2 else Path("benchmarks/out/bench_baseline.json")
+    parser = argparse.ArgumentParser(description="Compare a benchmark run against a baseline.")
+    parser.add_argument("current", help="bench_results.json from the run under test")
+    parser.add_argument(
+        "baseline",
+        nargs="?",
+        default=str(Path("benchmarks") / "out" / "bench_baseline.json"),
+        help="baseline results (default: benchmarks/out/bench_baseline.json)",
+    )
+    parser.add_argument(
+        "--report-threshold", type=float, default=10.0,
+        help="percent change worth listing at all (default: 10)",
+    )
+    parser.add_argument(
+        "--fail-threshold", type=float, default=20.0,
+        help="percent slowdown that fails the run (default: 20)",
+    )
+    parser.add_argument(
+        "--memory-fail-threshold", type=float, default=25.0,
+        help="percent peak-allocation growth that fails the run (default: 25)",
+    )
+    args = parser.parse_args()
+
+    current_path = Path(args.current)
+    baseline_path = Path(args.baseline)
 
     # Make paths absolute if not already
     if not current_path.is_absolute():
@@ -116,14 +180,20 @@ def main():
     if not baseline_path.is_absolute():
         baseline_path = Path.cwd() / baseline_path
 
-    if not Path(current_path).exists():
+    if not current_path.exists():
         print(f"Error: {current_path} not found")
         sys.exit(1)
-    if not Path(baseline_path).exists():
+    if not baseline_path.exists():
         print(f"Error: {baseline_path} not found")
         sys.exit(1)
 
-    return compare(str(current_path), str(baseline_path))
+    return compare(
+        str(current_path),
+        str(baseline_path),
+        args.report_threshold,
+        args.fail_threshold,
+        args.memory_fail_threshold,
+    )
 
 
 if __name__ == "__main__":
@@ -1,5 +1,15 @@
 
-from setuptools import setup
+from setuptools import setup, Extension
 
-# Use pyproject.toml for configuration
-setup() 
\ No newline at end of file
+# Use pyproject.toml for configuration.
+# The native varint backend is optional: when no C toolchain is available
+# the build succeeds anyway and integers.py falls back to pure Python.
+setup(
+    ext_modules=[
+        Extension(
+            "tsrkit_types._native",
+            sources=["tsrkit_types/_native.c"],
+            optional=True,
+        )
+    ]
+)
@@ -0,0 +1,84 @@
+"""Tests for arena decoding."""
+import gc
+
+from tsrkit_types.arena import Arena, arena_decode
+from tsrkit_types.integers import U16, U32
+from tsrkit_types.sequences import TypedVector
+from tsrkit_types.string import String
+from tsrkit_types.struct import structure
+
+
+@structure
+class Tx:
+    nonce: U32
+    memo: String
+
+
+@structure
+class Block:
+    height: U32
+    txs: TypedVector[Tx]
+
+
+def _make_block() -> Block:
+    return Block(
+        height=U32(7),
+        txs=TypedVector[Tx]([Tx(nonce=U32(i), memo=String(f"m{i}")) for i in range(50)]),
+    )
+
+
+class TestArenaDecoding:
+    """Test pooled structure allocation across decode cycles."""
+
+    def test_schema_discovery_and_preallocation(self):
+        """for_schema finds every reachable structure class and fills pools."""
+        arena = Arena.for_schema(Block, capacity=10)
+        assert arena.pooled(Block) == 10
+        assert arena.pooled(Tx) == 10
+
+    def test_instances_recycle_between_cycles(self):
+        """After reset(), the next decode reuses the previous cycle's objects."""
+        raw = _make_block().encode()
+        arena = Arena.for_schema(Block, capacity=50)
+
+        first = arena.decode(Block, raw)
+        assert first.encode() == raw
+        first_ids = {id(tx) for tx in first.txs}
+        arena.reset()
+        assert arena.pooled(Tx) == 50
+
+        second = arena.decode(Block, raw)
+        assert second.encode() == raw
+        assert {id(tx) for tx in second.txs} == first_ids
+
+    def test_gc_suspended_inside_context(self):
+        """Automatic collection pauses cannot land mid-decode."""
+        arena = Arena()
+        assert gc.isenabled()
+        with arena_decode(arena):
+            assert not gc.isenabled()
+        assert gc.isenabled()
+
+    def test_plain_decode_unaffected(self):
+        """Without an active arena, decoding allocates fresh instances."""
+        raw = _make_block().encode()
+        a, _ = Block.decode_from(raw)
+        b, _ = Block.decode_from(raw)
+        assert a.encode() == b.encode() == raw
+        assert a.txs[0] is not b.txs[0]
+
+    def test_fixed_layout_batch_uses_arena(self):
+        """The fused batch decoder also draws instances from the pool."""
+        @structure
+        class Point:
+            x: U16
+            y: U16
+
+        arena = Arena.for_schema(Point, capacity=4)
+        encoded = Point.encode_batch([Point(x=U16(1), y=U16(2))] * 4)
+        with arena_decode(arena):
+            points, _ = Point.decode_batch(encoded, 4)
+        assert arena.pooled(Point) == 0
+        assert len(points) == 4 and points[3].y == 2
+        arena.reset()
+        assert arena.pooled(Point) == 4
@@ -91,6 +91,41 @@ class TestBitsModification:
         bits[1] = True
         assert list(bits) == [True, True, True]
 
+    def test_reverse_and_sort(self):
+        """reverse() and sort() operate on the packed storage."""
+        bits = Bits([True, True, False, True, False])
+        bits.reverse()
+        assert list(bits) == [False, True, False, True, True]
+
+        bits.sort()
+        assert list(bits) == [False, False, True, True, True]
+        bits.sort(reverse=True)
+        assert list(bits) == [True, True, True, False, False]
+
+    def test_inplace_concat_and_repeat(self):
+        """+= and *= mutate the packed storage, not the hidden list."""
+        bits = Bits([True])
+        bits += [False]
+        assert list(bits) == [True, False]
+        assert list.__len__(bits) == 0  # backing list stays empty
+
+        bits *= 3
+        assert list(bits) == [True, False] * 3
+        assert bits.encode() == Bits([True, False] * 3).encode()
+
+        bits *= 0
+        assert len(bits) == 0
+
+    def test_concat_and_repeat_return_lists(self):
+        """+ and * box to plain bool lists, like slicing and copy()."""
+        bits = Bits([True, False])
+        assert bits + [True] == [True, False, True]
+        assert [True] + bits == [True, True, False]
+        assert bits + Bits([True]) == [True, False, True]
+        assert bits * 2 == [True, False, True, False]
+        assert 2 * bits == [True, False, True, False]
+        assert list(bits) == [True, False]  # operands untouched
+
     def test_append_non_bool_raises(self):
         """Test appending non-bool raises error."""
         bits = Bits([True, False])
@@ -127,6 +162,12 @@ class TestBitsJSON:
         bits = FixedBits.from_json(hex_input)
         assert list(bits) == expected_bits
 
+    @pytest.mark.parametrize("hex_input", ["", "0f"])
+    def test_from_json_truncated_raises(self, hex_input):
+        """Hex input shorter than a fixed size fails instead of corrupting."""
+        with pytest.raises(ValueError):
+            Bits[16].from_json(hex_input)
+
     @pytest.mark.parametrize("order", ["msb", "lsb"])
     def test_json_roundtrip(self, order):
         """Test JSON serialization roundtrip."""
@@ -344,6 +385,23 @@ class TestBytesIntegration:
         bits = a.to_bits()
         assert a == Bytes.from_bits(bits)
 
+    @pytest.mark.parametrize("order", ["msb", "lsb"])
+    def test_bytes_to_bits_packed(self, order):
+        """Packed conversion matches the list-of-bools path bit for bit."""
+        a = Bytes(bytes(range(32)))
+        packed = a.to_bits_packed(order)
+        assert isinstance(packed, Bits)
+        assert list(packed) == a.to_bits(order)
+        # Packed Bits round-trip back through from_bits without unpacking
+        assert Bytes.from_bits(packed, order) == a
+
+    def test_slice_bits_matches_to_bits(self):
+        """slice_bits agrees with slicing the full expansion, padding included."""
+        a = Bytes(bytes(range(8)))
+        full = a.to_bits()
+        assert a.slice_bits(3, 45) == full[3:45]
+        assert a.slice_bits(60, 70) == full[60:64] + [False] * 6
+
     @pytest.mark.parametrize("data,expected_type", [
         (b"hello", Bytes),
         (bytes(32), Bytes),
@@ -362,6 +420,61 @@ class TestBytesIntegration:
             assert a == Bytes.decode_from(enc)[0]
 
 
+class TestZeroCopyBytes:
+    """Test zero-copy Bytes decoding (merged with Bytes tests)."""
+
+    def test_zero_copy_returns_view(self):
+        """Decoding under zero_copy_decode returns a buffer-backed view."""
+        from tsrkit_types.bytes import BytesView
+        from tsrkit_types.itf.codable import zero_copy_decode
+
+        payload = Bytes(b"hello world")
+        encoded = payload.encode()
+
+        with zero_copy_decode():
+            decoded, bytes_read = Bytes.decode_from(encoded)
+
+        assert isinstance(decoded, BytesView)
+        assert bytes_read == len(encoded)
+        assert decoded == b"hello world"
+        assert len(decoded) == 11
+
+    def test_zero_copy_fixed_size(self):
+        """Fixed-size Bytes also decode as views."""
+        from tsrkit_types.bytes import BytesView
+        from tsrkit_types.itf.codable import zero_copy_decode
+
+        data = bytes(range(32))
+        encoded = Bytes[32](data).encode()
+
+        with zero_copy_decode():
+            decoded, _ = Bytes[32].decode_from(encoded)
+
+        assert isinstance(decoded, BytesView)
+        assert decoded == data
+
+    def test_view_freeze_and_reencode(self):
+        """Views materialize via freeze() and re-encode identically."""
+        from tsrkit_types.itf.codable import zero_copy_decode
+
+        original = Bytes(b"payload")
+        encoded = original.encode()
+
+        with zero_copy_decode():
+            decoded, _ = Bytes.decode_from(encoded)
+
+        frozen = decoded.freeze()
+        assert isinstance(frozen, Bytes)
+        assert frozen == original
+        assert decoded.encode() == encoded
+
+    def test_mode_is_scoped(self):
+        """Outside the context manager, decoding copies as before."""
+        encoded = Bytes(b"abc").encode()
+        decoded, _ = Bytes.decode_from(encoded)
+        assert isinstance(decoded, Bytes)
+
+
 class TestJAMCodecBitPacking:
     """JAM codec bit packing: pack bits into octets LSB to MSB."""
 
@@ -260,6 +260,65 @@ class TestDictionaries:
         assert restored[String("count")] == 42
         assert restored[String("limit")] == 100
 
+    def test_dictionary_incremental_mutation(self):
+        """Encoding stays correct across inserts, overwrites and deletes."""
+        StringToUint32 = Dictionary[String, Uint[32]]
+        data = StringToUint32({
+            String(f"key{i:02d}"): Uint[32](i) for i in range(20)
+        })
+        data.encode()  # populate the sorted-key and per-entry caches
+
+        data[String("aaa")] = Uint[32](1)       # insert before existing keys
+        data[String("key05")] = Uint[32](500)   # overwrite
+        del data[String("key10")]
+        data.pop(String("key11"))
+
+        decoded = StringToUint32.decode(data.encode())
+        assert decoded == data
+        assert decoded[String("key05")] == 500
+        assert String("key10") not in decoded
+
+    def test_dictionary_reencode_matches_fresh(self):
+        """A mutated dictionary encodes identically to a freshly built one."""
+        StringToUint8 = Dictionary[String, Uint[8]]
+        data = StringToUint8({String("b"): Uint[8](2)})
+        data.encode()
+        data[String("a")] = Uint[8](1)
+        data[String("c")] = Uint[8](3)
+
+        fresh = StringToUint8({
+            String("a"): Uint[8](1),
+            String("b"): Uint[8](2),
+            String("c"): Uint[8](3),
+        })
+        assert data.encode() == fresh.encode()
+
+    def test_dictionary_inplace_value_mutation_reencodes(self):
+        """Mutating a stored mutable value in place must not serve stale bytes."""
+        from tsrkit_types.struct import structure
+
+        @structure
+        class Account:
+            balance: Uint[32]
+
+        StringToAccount = Dictionary[String, Account]
+        data = StringToAccount({String("alice"): Account(balance=Uint[32](100))})
+        data.encode()  # would populate the entry cache if accounts were cacheable
+
+        data[String("alice")].balance = Uint[32](999)
+
+        fresh = StringToAccount({String("alice"): Account(balance=Uint[32](999))})
+        assert data.encode() == fresh.encode()
+
+    def test_dictionary_immutable_values_still_cached(self):
+        """Immutable value types keep populating the per-entry cache."""
+        StringToUint32 = Dictionary[String, Uint[32]]
+        data = StringToUint32({String("a"): Uint[32](1)})
+        data.encode()
+        assert String("a") in data._entry_cache
+        del data[String("a")]
+        assert not data._entry_cache
+
 
 class TestContainerValidation:
     """Test type validation in containers."""
@@ -367,3 +426,226 @@ class TestContainerIteration:
         assert len(keys) == 2
         assert len(values) == 2
         assert len(items) == 2
+
+
+class TestSinglePassEncoding:
+    """Test the BufWriter/encode_to single-pass encode path."""
+
+    def test_bufwriter_growth(self):
+        """Writer grows past its initial capacity transparently."""
+        from tsrkit_types.itf.codable import BufWriter
+
+        writer = BufWriter(initial_capacity=4)
+        writer.write(b"0123456789" * 10)
+        assert len(writer) == 100
+        assert writer.getvalue() == b"0123456789" * 10
+
+    def test_encode_to_matches_encode_into(self):
+        """Single-pass output is byte-identical to the two-pass path."""
+        from tsrkit_types.itf.codable import BufWriter
+
+        vec = TypedVector[Uint[16]]([Uint[16](i * 7) for i in range(50)])
+        buffer = bytearray(vec.encode_size())
+        written = vec.encode_into(buffer)
+
+        writer = BufWriter(initial_capacity=1)
+        vec.encode_to(writer)
+        assert writer.getvalue() == bytes(buffer[:written])
+
+    def test_nested_containers_single_pass(self):
+        """Nested containers encode through the writer recursively."""
+        d = Dictionary[String, TypedVector[Uint[8]]]({
+            String("xs"): TypedVector[Uint[8]]([Uint[8](1), Uint[8](2)]),
+            String("ys"): TypedVector[Uint[8]]([Uint[8](3)]),
+        })
+        encoded = d.encode()
+        decoded, bytes_read = Dictionary[String, TypedVector[Uint[8]]].decode_from(encoded)
+        assert decoded == d
+        assert bytes_read == len(encoded)
+
+
+class TestPooledEncoding:
+    """Test the thread-local writer pool behind encode()/encode_pooled()."""
+
+    def test_encode_pooled_matches_encode(self):
+        """The pooled view holds the same bytes as a regular encode."""
+        vec = TypedVector[Uint[16]]([Uint[16](i) for i in range(100)])
+        with vec.encode_pooled() as view:
+            assert bytes(view) == vec.encode()
+
+    def test_writer_reused_across_calls(self):
+        """Consecutive encodes on one thread recycle the pooled writer."""
+        from tsrkit_types.itf.codable import _acquire_writer, _release_writer
+
+        writer = _acquire_writer()
+        _release_writer(writer)
+        assert _acquire_writer() is writer
+        _release_writer(writer)
+
+        vec = TypedVector[Uint[8]]([Uint[8](1), Uint[8](2)])
+        for _ in range(3):
+            assert vec.encode() == vec.encode()
+
+
+class TestBatchCodec:
+    """Test encode_batch/decode_batch for homogeneous runs."""
+
+    def test_int_batch_roundtrip(self):
+        """Fixed-size int batches bulk-pack and match per-item encoding."""
+        values = [Uint[32](i * 17) for i in range(200)]
+        data = Uint[32].encode_batch(values)
+        assert data == b"".join(v.encode() for v in values)
+
+        decoded, bytes_read = Uint[32].decode_batch(data, 200)
+        assert decoded == values
+        assert bytes_read == len(data)
+        assert type(decoded[0]) is Uint[32]
+
+    def test_varint_batch_fallback(self):
+        """Variable-size ints go through the generic hoisted loop."""
+        values = [Uint(i * 37) for i in range(100)]
+        data = Uint.encode_batch(values)
+        decoded, bytes_read = Uint.decode_batch(data, 100)
+        assert decoded == values
+        assert bytes_read == len(data)
+
+    def test_seq_batch_fixed_arrays(self):
+        """Fixed arrays of fixed ints share one compiled struct per run."""
+        Arr = TypedArray[Uint[16], 3]
+        arrays = [Arr([Uint[16](i), Uint[16](i + 1), Uint[16](i + 2)]) for i in range(50)]
+        data = Arr.encode_batch(arrays)
+        assert data == b"".join(a.encode() for a in arrays)
+
+        decoded, bytes_read = Arr.decode_batch(data, 50)
+        assert decoded == arrays
+        assert bytes_read == len(data)
+
+    def test_batch_encode_into_buffer(self):
+        """In-place batch encode writes at the given offset."""
+        values = [Uint[16](i) for i in range(10)]
+        buffer = bytearray(2 + 20)
+        written = Uint[16].encode_batch(values, buffer, offset=2)
+        assert written == 20
+        assert bytes(buffer[2:]) == Uint[16].encode_batch(values)
+
+
+class TestIndexedEncoding:
+    """Test the random-access indexed Seq format and SeqView."""
+
+    def test_indexed_roundtrip(self):
+        """Indexed encoding decodes to the same elements via the view."""
+        Vec = TypedVector[String]
+        vec = Vec([String(f"value-{i}") for i in range(100)])
+        data = vec.encode_indexed()
+
+        view, bytes_read = Vec.decode_indexed(data)
+        assert bytes_read == len(data)
+        assert len(view) == 100
+        assert view.materialize() == vec
+
+    def test_point_lookup_is_lazy(self):
+        """Accessing one element does not decode the others."""
+        Vec = TypedVector[String]
+        vec = Vec([String("x" * (i % 7 + 1)) for i in range(500)])
+        view, _ = Vec.decode_indexed(vec.encode_indexed())
+
+        assert view[321] == vec[321]
+        assert len(view._cache) == 1  # only the accessed element decoded
+
+    def test_indexed_at_offset(self):
+        """The indexed format reports its exact size inside a larger buffer."""
+        Vec = TypedVector[Uint]
+        vec = Vec([Uint(i * 999) for i in range(50)])
+        data = vec.encode_indexed()
+        framed = b"\x00" * 5 + data + b"\xff" * 5
+
+        view, bytes_read = Vec.decode_indexed(framed, 5)
+        assert bytes_read == len(data)
+        assert list(view) == list(vec)
+
+
+class TestParallelDecode:
+    """Test the chunked multi-threaded decode path."""
+
+    def test_parallel_matches_serial(self):
+        """Parallel decode reassembles the exact serial result."""
+        Vec = TypedVector[Uint[32]]
+        vec = Vec([Uint[32](i * 3) for i in range(20000)])
+        data = vec.encode()
+
+        parallel, bytes_read = Vec.decode_parallel(data, max_workers=4, chunk_elements=4096)
+        serial, serial_read = Vec.decode_from(data)
+        assert list(parallel) == list(serial)
+        assert bytes_read == serial_read
+
+    def test_parallel_varint_elements(self):
+        """The skip pass chunks variable-size elements correctly."""
+        Vec = TypedVector[Uint]
+        vec = Vec([Uint(i * 1000) for i in range(10000)])
+        data = vec.encode()
+
+        decoded, bytes_read = Vec.decode_parallel(data, chunk_elements=1500)
+        assert decoded == vec
+        assert bytes_read == len(data)
+
+    def test_small_sequence_falls_back(self):
+        """Sequences within one chunk use the serial decoder."""
+        Vec = TypedVector[Uint[16]]
+        vec = Vec([Uint[16](i) for i in range(10)])
+        decoded, bytes_read = Vec.decode_parallel(vec.encode())
+        assert decoded == vec
+
+
+class TestRawSequences:
+    """Test array-backed sequences of unboxed machine values."""
+
+    def test_wire_compatible_with_boxed(self):
+        """RawSeq encodes byte-identically to the boxed equivalent."""
+        from tsrkit_types.sequences import RawSeq
+
+        values = [1, 300, 65535, 0]
+        raw = RawSeq[Uint[16]](values)
+        boxed = TypedVector[Uint[16]]([Uint[16](v) for v in values])
+        assert raw.encode() == boxed.encode()
+
+        fixed = RawSeq[Uint[32], 3]([7, 8, 9])
+        boxed_fixed = TypedArray[Uint[32], 3]([Uint[32](v) for v in (7, 8, 9)])
+        assert fixed.encode() == boxed_fixed.encode()
+
+    def test_round_trip_and_lazy_boxing(self):
+        """Decode keeps values unboxed; indexing returns typed elements."""
+        from tsrkit_types.sequences import RawSeq
+
+        Cls = RawSeq[Uint[32]]
+        original = Cls(range(1000))
+        decoded, bytes_read = Cls.decode_from(original.encode())
+        assert bytes_read == len(original.encode())
+        assert decoded == original
+        assert decoded._data.itemsize == 4  # unboxed backing store
+        assert type(decoded[617]) is Uint[32]
+        assert decoded[617] == 617
+        assert Cls.decode_size_from(original.encode()) == len(original.encode())
+
+    def test_bool_elements(self):
+        """Bool elements pack one byte each, matching Seq[Bool] encoding."""
+        from tsrkit_types.sequences import RawSeq
+
+        bits = [True, False, True, True]
+        raw = RawSeq[Bool](bits)
+        boxed = TypedVector[Bool]([Bool(b) for b in bits])
+        assert raw.encode() == boxed.encode()
+        decoded, _ = RawSeq[Bool].decode_from(raw.encode())
+        assert [bool(b) for b in decoded] == bits
+        assert decoded.to_json() == bits
+
+    def test_validation(self):
+        """Range, length-bound and element-type violations raise."""
+        from tsrkit_types.sequences import RawSeq
+
+        seq = RawSeq[Uint[16]]([1, 2])
+        with pytest.raises(ValueError):
+            seq.append(70000)
+        with pytest.raises(ValueError):
+            RawSeq[Uint[8], 2]([1])
+        with pytest.raises(TypeError):
+            RawSeq[String]
@@ -0,0 +1,128 @@
+"""Tests for the structural delta codec."""
+import pytest
+from tsrkit_types.delta import apply_delta, encode_delta
+from tsrkit_types.dictionary import Dictionary
+from tsrkit_types.integers import U16, U32, Uint
+from tsrkit_types.sequences import TypedVector
+from tsrkit_types.string import String
+from tsrkit_types.struct import structure
+
+
+@structure
+class Account:
+    balance: U32
+    nick: String
+
+
+@structure
+class State:
+    height: U32
+    accounts: Dictionary[String, Account]
+    log: TypedVector[U16]
+
+
+def _make_state() -> State:
+    return State(
+        height=U32(10),
+        accounts=Dictionary[String, Account]({
+            String("alice"): Account(balance=U32(100), nick=String("a")),
+            String("bob"): Account(balance=U32(50), nick=String("b")),
+        }),
+        log=TypedVector[U16]([U16(i) for i in range(100)]),
+    )
+
+
+class TestDeltaCodec:
+    """Test diffing and patching between versions of a value."""
+
+    def test_no_change_is_empty_patch(self):
+        """Identical values produce the one-byte empty patch."""
+        assert encode_delta(_make_state(), _make_state()) == b"\x00"
+
+    def test_patch_round_trip(self):
+        """Field, dict and seq mutations replay onto a fresh old copy."""
+        old, new = _make_state(), _make_state()
+        new.height = U32(11)
+        new.accounts[String("alice")].balance = U32(150)
+        del new.accounts[String("bob")]
+        new.accounts[String("carol")] = Account(balance=U32(7), nick=String("c"))
+        new.log[5] = U16(999)
+        new.log.append(U16(1234))
+
+        patch = encode_delta(old, new)
+        assert len(patch) < len(new.encode())  # O(changes), not O(state)
+
+        restored = apply_delta(_make_state(), patch)
+        assert restored.encode() == new.encode()
+
+    def test_patch_after_encode_invalidates_entry_cache(self):
+        """Patching a value inside an already-encoded dict must re-encode it."""
+        old, new = _make_state(), _make_state()
+        new.accounts[String("alice")].balance = U32(999)
+        patch = encode_delta(old, new)
+
+        target = _make_state()
+        target.encode()  # populate any per-entry caches before patching
+        restored = apply_delta(target, patch)
+        assert restored.accounts[String("alice")].balance == 999
+        assert restored.encode() == new.encode()
+
+    def test_sequence_shrink(self):
+        """Truncating a sequence travels as one resize op."""
+        old, new = _make_state(), _make_state()
+        del new.log[50:]
+        restored = apply_delta(_make_state(), encode_delta(old, new))
+        assert restored.encode() == new.encode()
+
+    def test_bare_containers_and_root_replace(self):
+        """Dictionaries, sequences and leaf values patch without a structure."""
+        d_old = Dictionary[String, U32]({String("x"): U32(1)})
+        d_new = Dictionary[String, U32]({String("x"): U32(2), String("y"): U32(3)})
+        patched = apply_delta(
+            Dictionary[String, U32]({String("x"): U32(1)}),
+            encode_delta(d_old, d_new),
+        )
+        assert patched.encode() == d_new.encode()
+
+        a, b = Uint(5), Uint(900)
+        assert apply_delta(a, encode_delta(a, b)) == 900
+
+    def test_bits_ship_whole(self):
+        """Bits fields travel as one replaced subtree, not per-bool ops."""
+        from tsrkit_types.bits import Bits
+
+        @structure
+        class Flags:
+            mask: Bits[8, "lsb"]
+
+        old = Flags(mask=Bits[8, "lsb"]([False] * 8))
+        new = Flags(mask=Bits[8, "lsb"]([True, False] * 4))
+        restored = apply_delta(Flags(mask=Bits[8, "lsb"]([False] * 8)),
+                               encode_delta(old, new))
+        assert restored.encode() == new.encode()
+
+        StringToFlags = Dictionary[String, Flags]
+        d_old = StringToFlags({String("x"): Flags(mask=Bits[8, "lsb"]([False] * 8))})
+        d_new = StringToFlags({String("x"): Flags(mask=Bits[8, "lsb"]([True] * 8))})
+        target = StringToFlags({String("x"): Flags(mask=Bits[8, "lsb"]([False] * 8))})
+        target.encode()
+        patched = apply_delta(target, encode_delta(d_old, d_new))
+        assert patched.encode() == d_new.encode()
+
+    def test_frozen_slots_structures(self):
+        """Patching works through object.__setattr__ on frozen/slots classes."""
+        @structure(frozen=True, slots=True)
+        class Point:
+            x: U16
+            y: U16
+
+        old, new = Point(x=U16(1), y=U16(2)), Point(x=U16(1), y=U16(9))
+        assert apply_delta(Point(x=U16(1), y=U16(2)), encode_delta(old, new)) == new
+
+    def test_unknown_op_rejected(self):
+        """Corrupted op bytes raise instead of silently misapplying."""
+        patch = encode_delta(Uint(1), Uint(2))
+        corrupted = bytearray(patch)
+        corrupted[2] = 0x7F  # op byte
+        with pytest.raises(ValueError):
+            apply_delta(Uint(1), bytes(corrupted))
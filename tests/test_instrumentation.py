@@ -0,0 +1,76 @@
+"""Tests for the opt-in codec instrumentation surface."""
+import pytest
+from tsrkit_types.integers import Uint, U32
+from tsrkit_types.itf.codable import (
+    CodecCollector,
+    install_collector,
+    uninstall_collector,
+)
+from tsrkit_types.sequences import TypedVector
+from tsrkit_types.string import String
+from tsrkit_types.struct import structure
+
+
+@structure
+class Sample:
+    id: U32
+    name: String
+
+
+class TestCodecInstrumentation:
+    """Test per-type counters collected at the top-level entry points."""
+
+    def test_counters_accumulate(self):
+        """encode/decode calls, bytes and time are tallied per type."""
+        collector = install_collector()
+        try:
+            sample = Sample(id=U32(1), name=String("probe"))
+            for _ in range(3):
+                data = sample.encode()
+            Sample.decode(data)
+
+            stats = collector.snapshot()["Sample"]
+            assert stats["encode"]["calls"] == 3
+            assert stats["encode"]["bytes"] == 3 * len(data)
+            assert stats["decode"]["calls"] == 1
+            assert stats["decode"]["bytes"] == len(data)
+            assert stats["encode"]["seconds"] >= 0.0
+        finally:
+            uninstall_collector()
+
+    def test_no_double_counting_nested(self):
+        """A container records its subtree once under the container type."""
+        collector = install_collector()
+        try:
+            vec = TypedVector[Uint]([Uint(i) for i in range(10)])
+            vec.encode()
+            snapshot = collector.snapshot()
+            assert len(snapshot) == 1  # only the vector type, not Uint
+            (stats,) = snapshot.values()
+            assert stats["encode"]["calls"] == 1
+        finally:
+            uninstall_collector()
+
+    def test_disabled_by_default(self):
+        """Without an installed collector nothing is recorded."""
+        collector = CodecCollector()
+        Uint(5).encode()
+        assert collector.snapshot() == {}
+
+    def test_uninstall_returns_collector(self):
+        """uninstall hands back the active collector and stops recording."""
+        collector = install_collector()
+        assert uninstall_collector() is collector
+        Uint(5).encode()
+        assert collector.snapshot() == {}
+
+    def test_reset(self):
+        """reset() clears accumulated counters."""
+        collector = install_collector()
+        try:
+            Uint(1).encode()
+            assert collector.snapshot()
+            collector.reset()
+            assert collector.snapshot() == {}
+        finally:
+            uninstall_collector()
@@ -335,3 +335,62 @@ class TestJAMCodecCompliance:
         value = 2 ** power
         num = Uint(value)
         assert Uint.decode(num.encode()) == num
+
+
+class TestSmallValueCache:
+    """Test the per-class cache of preconstructed small instances."""
+
+    def test_decode_returns_shared_instance(self):
+        """Small decoded values are identical objects, not fresh allocations."""
+        a, _ = Uint[8].decode_from(b"\x01")
+        b, _ = Uint[8].decode_from(b"\x01")
+        assert a is b
+        assert a == 1
+
+    def test_constructor_serves_from_cache(self):
+        """Direct construction of small values also hits the cache."""
+        assert Uint[8](5) is Uint[8](5)
+        assert Uint(7) is Uint(7)
+
+    def test_large_values_not_cached(self):
+        """Values past the cache bound still allocate normally."""
+        a, _ = Uint[32].decode_from((100000).to_bytes(4, "little"))
+        b, _ = Uint[32].decode_from((100000).to_bytes(4, "little"))
+        assert a == b == 100000
+        assert a is not b
+
+    def test_range_checks_still_enforced(self):
+        """The cache does not bypass out-of-range validation."""
+        with pytest.raises(ValueError):
+            Uint[8](256)
+
+
+class TestVarintTagTable:
+    """Test the precomputed tag dispatch table against first principles."""
+
+    def test_table_matches_reference_math(self):
+        """Every tag byte maps to the (length, alpha) the bit math derives."""
+        from tsrkit_types.integers import _VARINT_TAG_TABLE
+
+        for tag in range(256):
+            _l, alpha = _VARINT_TAG_TABLE[tag]
+            if tag < 128:
+                assert (_l, alpha) == (0, tag)
+            elif tag == 255:
+                assert (_l, alpha) == (8, 0)
+            else:
+                x = 256 - tag
+                expected_l = (9 if (x & (x - 1)) == 0 else 8) - x.bit_length()
+                assert _l == expected_l
+                assert alpha == tag + (1 << (8 - _l)) - 256
+
+    def test_size_table_round_trip(self):
+        """encode_size, decode_size_from and the encoding length all agree."""
+        for value in [0, 1, 127, 128, 2**14 - 1, 2**14, 2**21, 2**28, 2**35,
+                      2**42, 2**49, 2**56 - 1, 2**56, 2**64 - 1]:
+            num = Uint(value)
+            encoded = num.encode()
+            assert num.encode_size() == len(encoded)
+            assert Uint.decode_size_from(encoded) == len(encoded)
+            decoded, size = Uint.decode_from(encoded)
+            assert decoded == value and size == len(encoded)
@@ -257,3 +257,57 @@ class TestReasonableLimits:
         assert MAX_BYTEARRAY_SIZE < 10_000_000_000
         assert MAX_STRING_BYTES < 1_000_000_000
         assert MAX_BITS_LENGTH < 10_000_000_000
+
+
+class TestTrustedDecodeMode:
+    """Trusted mode trades validation for speed on pre-verified input."""
+
+    def test_trusted_roundtrip_matches_default(self):
+        """Trusted decode produces the same values as the validating path."""
+        from tsrkit_types.itf.codable import trusted_decode
+        from tsrkit_types.sequences import TypedVector
+
+        vec = TypedVector[U32]([U32(i * 31) for i in range(200)])
+        encoded = vec.encode()
+
+        with trusted_decode():
+            fast, read = TypedVector[U32].decode_from(encoded)
+
+        slow, _ = TypedVector[U32].decode_from(encoded)
+        assert list(fast) == list(slow)
+        assert read == len(encoded)
+        assert fast.encode() == encoded
+
+    def test_trusted_kwarg_on_decode(self):
+        """Codable.decode(trusted=True) enables the mode for one call."""
+        d = Dictionary[String, U8]({String("a"): U8(1), String("b"): U8(2)})
+        encoded = d.encode()
+        decoded = Dictionary[String, U8].decode(encoded, trusted=True)
+        assert decoded == d
+
+    def test_trusted_skips_key_ordering_check(self):
+        """Out-of-order keys decode in trusted mode but are rejected by default."""
+        from tsrkit_types.itf.codable import trusted_decode
+
+        # Hand-build an encoding with keys in descending order
+        buf = bytearray()
+        buf += Uint(2).encode()
+        for k, v in [(String("b"), U8(1)), (String("a"), U8(2))]:
+            buf += k.encode() + v.encode()
+
+        with pytest.raises(ValueError, match="ascending order"):
+            Dictionary[String, U8].decode_from(bytes(buf))
+
+        with trusted_decode():
+            decoded, _ = Dictionary[String, U8].decode_from(bytes(buf))
+        assert decoded[String("a")] == 2
+
+    def test_mode_is_scoped(self):
+        """Validation resumes outside the context manager."""
+        buf = bytearray()
+        buf += Uint(2).encode()
+        for k, v in [(String("b"), U8(1)), (String("a"), U8(2))]:
+            buf += k.encode() + v.encode()
+
+        with pytest.raises(ValueError):
+            Dictionary[String, U8].decode_from(bytes(buf))
@@ -0,0 +1,85 @@
+"""Tests for the memory-mapped snapshot reader."""
+import os
+import tempfile
+
+import pytest
+from tsrkit_types.bytes import Bytes, BytesView
+from tsrkit_types.integers import U32, Uint
+from tsrkit_types.sequences import TypedVector
+from tsrkit_types.snapshot import SnapshotReader
+from tsrkit_types.string import String
+from tsrkit_types.struct import structure
+
+
+@structure
+class Entry:
+    key: U32
+    payload: Bytes
+    note: String
+
+
+def _write_snapshot(data: bytes) -> str:
+    fd, path = tempfile.mkstemp(suffix=".bin")
+    with os.fdopen(fd, "wb") as f:
+        f.write(data)
+    return path
+
+
+class TestSnapshotReader:
+    """Test decoding straight off the file mapping."""
+
+    def test_sequential_records(self):
+        """records() walks consecutive encodings to end of file."""
+        entries = [
+            Entry(key=U32(i), payload=Bytes(bytes([i] * 10)), note=String(f"e{i}"))
+            for i in range(20)
+        ]
+        path = _write_snapshot(b"".join(e.encode() for e in entries))
+        try:
+            with SnapshotReader(path, zero_copy=False) as snap:
+                decoded = list(snap.records(Entry))
+                assert [int(e.key) for e in decoded] == list(range(20))
+                assert bytes(decoded[7].payload) == bytes([7] * 10)
+        finally:
+            os.unlink(path)
+
+    def test_zero_copy_payloads(self):
+        """Bytes fields decode as views into the mapping, not heap copies."""
+        entry = Entry(key=U32(1), payload=Bytes(b"\xab" * 1000), note=String("z"))
+        path = _write_snapshot(entry.encode())
+        try:
+            snap = SnapshotReader(path)
+            decoded = snap.decode(Entry)
+            assert isinstance(decoded.payload, BytesView)
+            frozen = decoded.payload.release()  # detach before closing
+            snap.close()
+            assert frozen == b"\xab" * 1000
+            assert bytes(decoded.payload) == b"\xab" * 1000  # reads still work
+        finally:
+            os.unlink(path)
+
+    def test_indexed_view_off_mapping(self):
+        """view_indexed serves point lookups without scanning the file."""
+        Vec = TypedVector[String]
+        vec = Vec([String(f"record-{i}") for i in range(1000)])
+        path = _write_snapshot(vec.encode_indexed())
+        try:
+            with SnapshotReader(path) as snap:
+                view = snap.view_indexed(Vec)
+                assert len(view) == 1000
+                assert view[617] == "record-617"
+                assert len(view._cache) == 1
+        finally:
+            os.unlink(path)
+
+    def test_decode_at_offset(self):
+        """decode/decode_from honor explicit offsets into the file."""
+        a, b = Uint(300), Uint(7)
+        path = _write_snapshot(a.encode() + b.encode())
+        try:
+            with SnapshotReader(path) as snap:
+                first, size = snap.decode_from(Uint)
+                assert first == 300
+                assert snap.decode(Uint, offset=size) == 7
+        finally:
+            os.unlink(path)
@@ -0,0 +1,191 @@
+"""Tests for the streaming frame codec (FrameReader/FrameWriter)."""
+import io
+
+import pytest
+from tsrkit_types.integers import Uint, U32
+from tsrkit_types.string import String
+from tsrkit_types.stream import FrameReader, FrameWriter
+from tsrkit_types.struct import structure
+
+
+@structure
+class Record:
+    id: U32
+    name: String
+
+
+class TestFrameRoundtrip:
+    """Test writing and reading frames through a stream."""
+
+    def test_file_roundtrip(self):
+        """Values written as frames read back in order."""
+        buf = io.BytesIO()
+        writer = FrameWriter(buf)
+        records = [Record(id=U32(i), name=String(f"rec-{i}")) for i in range(10)]
+        for rec in records:
+            writer.write(rec)
+
+        buf.seek(0)
+        reader = FrameReader(Record, stream=buf)
+        assert list(reader) == records
+
+    def test_mixed_frame_sizes(self):
+        """Small and multi-chunk frames interleave correctly."""
+        buf = io.BytesIO()
+        writer = FrameWriter(buf, chunk_size=16)
+        big = Record(id=U32(1), name=String("x" * 1000))
+        small = Record(id=U32(2), name=String("y"))
+        writer.write(big)
+        writer.write(small)
+
+        buf.seek(0)
+        reader = FrameReader(Record, stream=buf, chunk_size=7)
+        assert list(reader) == [big, small]
+
+
+class TestIncrementalFeed:
+    """Test the push-mode resumable state machine."""
+
+    def test_byte_by_byte_feed(self):
+        """Frames decode correctly even when fed one byte at a time."""
+        buf = io.BytesIO()
+        writer = FrameWriter(buf)
+        records = [Record(id=U32(i), name=String("n" * (i * 50))) for i in range(5)]
+        for rec in records:
+            writer.write(rec)
+        data = buf.getvalue()
+
+        reader = FrameReader(Record)
+        decoded = []
+        for i in range(len(data)):
+            reader.feed(data[i:i + 1])
+            while (value := reader.read()) is not None:
+                decoded.append(value)
+        assert decoded == records
+
+    def test_read_returns_none_until_complete(self):
+        """Partial prefix and partial payload both suspend cleanly."""
+        encoded = FrameWriterBytes(Record(id=U32(7), name=String("z" * 200)))
+
+        reader = FrameReader(Record)
+        reader.feed(encoded[:1])
+        assert reader.read() is None  # mid-varint
+        reader.feed(encoded[1:50])
+        assert reader.read() is None  # mid-payload
+        reader.feed(encoded[50:])
+        assert reader.read() is not None
+
+    def test_oversized_frame_rejected(self):
+        """Frames past max_frame_size raise instead of allocating."""
+        reader = FrameReader(Record, max_frame_size=100)
+        reader.feed(Uint(1000).encode() + bytes(100))
+        with pytest.raises(ValueError, match="exceeds maximum"):
+            reader.read()
+
+    def test_truncated_stream_raises(self):
+        """Pull mode raises if the stream ends mid-frame."""
+        encoded = FrameWriterBytes(Record(id=U32(1), name=String("abc")))
+        buf = io.BytesIO(encoded[:-2])
+        reader = FrameReader(Record, stream=buf)
+        with pytest.raises(ValueError, match="mid-frame"):
+            list(reader)
+
+
+def FrameWriterBytes(value) -> bytes:
+    """Encode a single value as one frame."""
+    buf = io.BytesIO()
+    FrameWriter(buf).write(value)
+    return buf.getvalue()
+
+
+class _DrainWriter:
+    """Minimal StreamWriter stand-in: collects writes, counts drains."""
+
+    def __init__(self):
+        self.chunks = []
+        self.drains = 0
+
+    def write(self, data):
+        self.chunks.append(bytes(data))
+
+    async def drain(self):
+        self.drains += 1
+
+    def getvalue(self) -> bytes:
+        return b"".join(self.chunks)
+
+
+class TestAsyncStream:
+    """Test the asyncio encode_stream/decode_stream layer."""
+
+    def test_async_roundtrip(self):
+        """Values written with encode_stream decode back with decode_stream."""
+        import asyncio
+        from tsrkit_types.stream import decode_stream, encode_stream
+
+        async def scenario():
+            writer = _DrainWriter()
+            records = [Record(id=U32(i), name=String(f"async-{i}")) for i in range(5)]
+            for rec in records:
+                await encode_stream(writer, rec)
+
+            reader = asyncio.StreamReader()
+            reader.feed_data(writer.getvalue())
+            reader.feed_eof()
+            decoded = [await decode_stream(reader, Record) for _ in range(5)]
+            assert decoded == records
+            assert await decode_stream(reader, Record) is None  # clean EOF
+
+        asyncio.run(scenario())
+
+    def test_chunked_writes_apply_backpressure(self):
+        """Large payloads are written in chunks with a drain between each."""
+        import asyncio
+        from tsrkit_types.stream import decode_stream, encode_stream
+
+        async def scenario():
+            writer = _DrainWriter()
+            big = Record(id=U32(1), name=String("z" * 4096))
+            await encode_stream(writer, big, chunk_size=512)
+            assert writer.drains >= 8
+
+            reader = asyncio.StreamReader()
+            reader.feed_data(writer.getvalue())
+            reader.feed_eof()
+            assert await decode_stream(reader, Record) == big
+
+        asyncio.run(scenario())
+
+    def test_truncated_async_stream_raises(self):
+        """A stream ending mid-frame raises IncompleteReadError."""
+        import asyncio
+        from tsrkit_types.stream import decode_stream
+
+        async def scenario():
+            encoded = FrameWriterBytes(Record(id=U32(3), name=String("abc")))
+            reader = asyncio.StreamReader()
+            reader.feed_data(encoded[:-2])
+            reader.feed_eof()
+            with pytest.raises(asyncio.IncompleteReadError):
+                await decode_stream(reader, Record)
+
+        asyncio.run(scenario())
+
+    def test_iter_stream(self):
+        """iter_stream yields every frame until clean EOF."""
+        import asyncio
+        from tsrkit_types.stream import encode_stream, iter_stream
+
+        async def scenario():
+            writer = _DrainWriter()
+            records = [Record(id=U32(i), name=String("r" * i)) for i in range(8)]
+            for rec in records:
+                await encode_stream(writer, rec)
+
+            reader = asyncio.StreamReader()
+            reader.feed_data(writer.getvalue())
+            reader.feed_eof()
+            decoded = [value async for value in iter_stream(reader, Record)]
+            assert decoded == records
+
+        asyncio.run(scenario())
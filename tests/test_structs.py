@@ -5,6 +5,7 @@ from tsrkit_types.string import String
 from tsrkit_types.bool import Bool
 from tsrkit_types.choice import Choice
 from tsrkit_types.option import Option
+from tsrkit_types.bytes import Bytes
 from tsrkit_types.sequences import TypedVector
 from tsrkit_types.enum import Enum
 from tsrkit_types.struct import structure
@@ -494,4 +495,161 @@ def test_struct_with_null_type():
     assert not original.text
     assert original.number == 42
     assert bool(original.flag) is True
-    
\ No newline at end of file
+    
+
+def test_lazy_decode_fields_on_access():
+    """decode_lazy scans offsets once and decodes fields on first access."""
+    @structure
+    class Header:
+        height: Uint[32]
+        parent: Bytes[32]
+        note: String
+
+    header = Header(
+        height=Uint[32](42),
+        parent=Bytes[32](bytes(range(32))),
+        note=String("hello"),
+    )
+    encoded = header.encode()
+
+    lazy, bytes_read = Header.decode_lazy(encoded)
+    assert bytes_read == len(encoded)
+
+    # Nothing decoded yet
+    assert "note" not in lazy.__dict__
+
+    # First access decodes and caches
+    assert lazy.note == "hello"
+    assert "note" in lazy.__dict__
+    assert lazy.height == 42
+    assert lazy.parent == bytes(range(32))
+
+
+def test_decode_size_from_matches_encoding():
+    """decode_size_from skips a struct without materializing its fields."""
+    @structure
+    class Pair:
+        a: Uint
+        b: String
+
+    pair = Pair(a=Uint(300), b=String("world"))
+    encoded = pair.encode()
+    assert Pair.decode_size_from(encoded) == len(encoded)
+
+
+def test_lazy_decode_equals_eager():
+    """Lazy instances compare equal to eagerly decoded ones."""
+    @structure
+    class Point:
+        x: Uint[16]
+        y: Uint[16]
+
+    encoded = Point(x=Uint[16](3), y=Uint[16](9)).encode()
+    lazy, _ = Point.decode_lazy(encoded)
+    eager = Point.decode(encoded)
+    assert lazy == eager
+
+
+def test_fixed_layout_struct_fast_path():
+    """All-fixed-size structs encode/decode through one fused struct.Struct."""
+    @structure
+    class BlockHeader:
+        version: U8
+        flag: Bool
+        height: U32
+        parent: Bytes[32]
+
+    header = BlockHeader(
+        version=U8(1),
+        flag=Bool(True),
+        height=U32(99999),
+        parent=Bytes[32](bytes(range(32))),
+    )
+    assert header.encode_size() == 1 + 1 + 4 + 32
+    encoded = header.encode()
+
+    decoded, bytes_read = BlockHeader.decode_from(encoded)
+    assert bytes_read == len(encoded)
+    assert decoded.version == 1
+    assert bool(decoded.flag) is True
+    assert decoded.height == 99999
+    assert decoded.parent == bytes(range(32))
+    assert type(decoded.height) is U32
+    assert BlockHeader.decode_size_from(encoded) == len(encoded)
+
+
+def test_fixed_layout_matches_generic_encoding():
+    """The fused format is byte-identical to field-by-field encoding."""
+    @structure
+    class Fixed:
+        a: U16
+        b: U32
+
+    value = Fixed(a=U16(0x1234), b=U32(0xDEADBEEF))
+    expected = U16(0x1234).encode() + U32(0xDEADBEEF).encode()
+    assert value.encode() == expected
+
+    buffer = bytearray(value.encode_size())
+    assert value.encode_into(buffer) == len(expected)
+    assert bytes(buffer) == expected
+
+
+def test_slots_structs():
+    """slots=True drops the instance __dict__ but keeps the full codec."""
+    @structure(slots=True)
+    class Compact:
+        name: String
+        height: U32
+
+    value = Compact(name=String("node"), height=U32(42))
+    assert not hasattr(value, "__dict__")
+    with pytest.raises(AttributeError):
+        value.extra = 1
+
+    decoded, bytes_read = Compact.decode_from(value.encode())
+    assert bytes_read == len(value.encode())
+    assert decoded == value
+    assert not hasattr(decoded, "__dict__")
+
+    # Lazy decode works through the dedicated bookkeeping slots
+    lazy, _ = Compact.decode_lazy(value.encode())
+    assert lazy.height == 42
+
+    # Field slots are defined exactly once in the MRO (no duplicate layout)
+    owners = [c for c in type(value).__mro__ if "name" in getattr(c, "__dict__", {})]
+    assert len(owners) == 1
+
+
+def test_slots_with_frozen_and_fixed_layout():
+    """slots composes with frozen and with the fused fixed-layout codec."""
+    @structure(frozen=True, slots=True)
+    class Point:
+        x: U16
+        y: U16
+
+    p = Point(x=U16(3), y=U16(7))
+    with pytest.raises(Exception):
+        p.x = U16(9)
+
+    encoded = Point.encode_batch([p, p])
+    values, bytes_read = Point.decode_batch(encoded, 2)
+    assert bytes_read == len(encoded)
+    assert values[0] == p and values[1] == p
+    assert not hasattr(values[0], "__dict__")
+
+
+def test_decode_skips_init_revalidation():
+    """decode_from assembles instances directly unless __post_init__ exists."""
+    calls = []
+
+    @structure
+    class Checked:
+        x: U16
+
+        def __post_init__(self):
+            calls.append(int(self.x))
+
+    value = Checked(x=U16(5))
+    decoded, _ = Checked.decode_from(value.encode())
+    assert decoded == value
+    assert calls == [5, 5]  # construction and decode both ran the hook
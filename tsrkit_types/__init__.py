@@ -6,7 +6,15 @@ serialization capabilities, including integers, strings, containers, and more.
 """
 
 # Core interfaces
-from .itf.codable import Codable
+from .itf.codable import (
+    Codable,
+    BufWriter,
+    CodecCollector,
+    install_collector,
+    uninstall_collector,
+    zero_copy_decode,
+    trusted_decode,
+)
 
 
 # Integer types
@@ -27,9 +35,10 @@ from .option import Option
 
 # Container types
 from .sequences import (
-    Seq, Vector, Array, 
-    TypedVector, TypedArray, 
-    BoundedVector, TypedBoundedVector
+    Seq, Vector, Array,
+    TypedVector, TypedArray,
+    BoundedVector, TypedBoundedVector,
+    RawSeq,
 )
 
 # Dictionary types
@@ -48,11 +57,24 @@ from .enum import Enum
 # Structure decorator
 from .struct import structure, struct
 
+# Streaming frame codec
+from .stream import FrameReader, FrameWriter, decode_stream, encode_stream, iter_stream
+
+# Memory-mapped snapshot reader
+from .snapshot import SnapshotReader
+
+# Structural delta codec
+from .delta import apply_delta, encode_delta
+
+# Arena decoding
+from .arena import Arena, arena_decode
+
 # Export all public types
 __all__ = [
     # Core interfaces
-    "Codable",
-    
+    "Codable", "BufWriter", "zero_copy_decode", "trusted_decode",
+    "CodecCollector", "install_collector", "uninstall_collector",
+
     # Integer types
     "Uint", "U8", "U16", "U32", "U64",
     
@@ -70,8 +92,9 @@ __all__ = [
     
     # Container types
     "Seq", "Vector", "Array",
-    "TypedVector", "TypedArray", 
+    "TypedVector", "TypedArray",
     "BoundedVector", "TypedBoundedVector",
+    "RawSeq",
     
     # Dictionary types
     "Dictionary",
@@ -89,6 +112,17 @@ __all__ = [
     # Structure decorator
     "structure", "struct",
 
+    # Streaming frame codec
+    "FrameReader", "FrameWriter", "decode_stream", "encode_stream", "iter_stream",
+
+    # Memory-mapped snapshot reader
+    "SnapshotReader",
+
+    # Structural delta codec
+    "encode_delta", "apply_delta",
+
+    # Arena decoding
+    "Arena", "arena_decode",
 ]
 
 # Version information
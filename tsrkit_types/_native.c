@@ -0,0 +1,202 @@
+/*
+ * Native backend for the general-Uint variable-length integer codec.
+ *
+ * Implements the same tag/alpha/beta wire format as the pure-Python
+ * implementation in tsrkit_types/integers.py:
+ *
+ *   value < 2^7   -> 1 byte, the value itself
+ *   value < 2^56  -> 1 prefix byte (tag) + l payload bytes, little-endian,
+ *                    where l = floor((bit_length - 1) / 7),
+ *                    tag = (256 - 2^(8-l)) + (value >> (8*l))
+ *   value < 2^64  -> 0xFF marker + 8 bytes little-endian
+ *
+ * The module is optional: integers.py falls back to the pure-Python path
+ * when it is not importable (see `make build` / setup.py build_ext).
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+/* ------------------------------------------------------------------ */
+/*                             Encoding                               */
+/* ------------------------------------------------------------------ */
+
+static inline int
+varint_size(unsigned long long value)
+{
+    int bits, l;
+    if (value < 128ULL) {
+        return 1;
+    }
+    if (value >= (1ULL << 56)) {
+        return 9;
+    }
+    bits = 64 - __builtin_clzll(value);
+    l = (bits - 1) / 7;
+    return 1 + l;
+}
+
+static PyObject *
+uint_encode_size(PyObject *self, PyObject *arg)
+{
+    unsigned long long value = PyLong_AsUnsignedLongLong(arg);
+    if (value == (unsigned long long)-1 && PyErr_Occurred()) {
+        return NULL;
+    }
+    return PyLong_FromLong(varint_size(value));
+}
+
+static PyObject *
+uint_encode_into(PyObject *self, PyObject *args)
+{
+    PyObject *value_obj, *buffer_obj;
+    Py_ssize_t offset = 0;
+    unsigned long long value;
+    Py_buffer view;
+    unsigned char *out;
+    int size, l, i;
+
+    if (!PyArg_ParseTuple(args, "OO|n", &value_obj, &buffer_obj, &offset)) {
+        return NULL;
+    }
+    value = PyLong_AsUnsignedLongLong(value_obj);
+    if (value == (unsigned long long)-1 && PyErr_Occurred()) {
+        return NULL;
+    }
+    if (PyObject_GetBuffer(buffer_obj, &view, PyBUF_WRITABLE) < 0) {
+        return NULL;
+    }
+
+    size = varint_size(value);
+    if (offset < 0 || view.len - offset < size) {
+        PyBuffer_Release(&view);
+        PyErr_SetString(PyExc_ValueError, "Buffer too small to encode value");
+        return NULL;
+    }
+    out = (unsigned char *)view.buf + offset;
+
+    if (value < 128ULL) {
+        out[0] = (unsigned char)value;
+    } else if (value < (1ULL << 56)) {
+        l = size - 1;
+        out[0] = (unsigned char)((256 - (1 << (8 - l))) + (value >> (l * 8)));
+        for (i = 0; i < l; i++) {
+            out[1 + i] = (unsigned char)(value >> (i * 8));
+        }
+    } else {
+        out[0] = 0xFF;
+        for (i = 0; i < 8; i++) {
+            out[1 + i] = (unsigned char)(value >> (i * 8));
+        }
+    }
+
+    PyBuffer_Release(&view);
+    return PyLong_FromLong(size);
+}
+
+/* ------------------------------------------------------------------ */
+/*                             Decoding                               */
+/* ------------------------------------------------------------------ */
+
+static PyObject *
+uint_decode_from(PyObject *self, PyObject *args)
+{
+    PyObject *buffer_obj;
+    Py_ssize_t offset = 0;
+    Py_buffer view;
+    const unsigned char *in;
+    unsigned long long value;
+    unsigned int tag;
+    int l, x, i;
+
+    if (!PyArg_ParseTuple(args, "O|n", &buffer_obj, &offset)) {
+        return NULL;
+    }
+    if (PyObject_GetBuffer(buffer_obj, &view, PyBUF_SIMPLE) < 0) {
+        return NULL;
+    }
+
+    /* Mirrors the pure-Python path: an out-of-range offset reads a zero
+     * tag (empty slice) and decodes as the value 0. */
+    if (offset < 0 || offset >= view.len) {
+        PyBuffer_Release(&view);
+        return Py_BuildValue("(Ki)", 0ULL, 1);
+    }
+    in = (const unsigned char *)view.buf + offset;
+    tag = in[0];
+
+    if (tag < 128) {
+        PyBuffer_Release(&view);
+        return Py_BuildValue("(Ki)", (unsigned long long)tag, 1);
+    }
+
+    if (tag == 255) {
+        if (view.len - offset < 9) {
+            PyBuffer_Release(&view);
+            PyErr_SetString(PyExc_ValueError,
+                            "Buffer too small to decode 64-bit integer");
+            return NULL;
+        }
+        value = 0;
+        for (i = 0; i < 8; i++) {
+            value |= (unsigned long long)in[1 + i] << (i * 8);
+        }
+        PyBuffer_Release(&view);
+        return Py_BuildValue("(Ki)", value, 9);
+    }
+
+    /* l = 8 - bit_length(256 - tag), +1 when (256 - tag) is a power of 2 */
+    x = 256 - (int)tag;
+    if ((x & (x - 1)) == 0) {
+        l = 9 - (32 - __builtin_clz((unsigned int)x));
+    } else {
+        l = 8 - (32 - __builtin_clz((unsigned int)x));
+    }
+
+    if (view.len - offset < l + 1) {
+        PyBuffer_Release(&view);
+        PyErr_SetString(PyExc_ValueError,
+                        "Buffer too small to decode variable-length integer");
+        return NULL;
+    }
+
+    value = 0;
+    for (i = 0; i < l; i++) {
+        value |= (unsigned long long)in[1 + i] << (i * 8);
+    }
+    value += (unsigned long long)(tag + (1 << (8 - l)) - 256) << (l * 8);
+
+    PyBuffer_Release(&view);
+    return Py_BuildValue("(Ki)", value, l + 1);
+}
+
+/* ------------------------------------------------------------------ */
+/*                          Module boilerplate                        */
+/* ------------------------------------------------------------------ */
+
+static PyMethodDef native_methods[] = {
+    {"uint_encode_size", uint_encode_size, METH_O,
+     "uint_encode_size(value) -> int\n\n"
+     "Number of bytes the general-Uint encoding of `value` occupies."},
+    {"uint_encode_into", uint_encode_into, METH_VARARGS,
+     "uint_encode_into(value, buffer, offset=0) -> int\n\n"
+     "Encode `value` into a writable buffer; returns bytes written."},
+    {"uint_decode_from", uint_decode_from, METH_VARARGS,
+     "uint_decode_from(buffer, offset=0) -> (value, size)\n\n"
+     "Decode a general-Uint value; returns the value and bytes read."},
+    {NULL, NULL, 0, NULL},
+};
+
+static struct PyModuleDef native_module = {
+    PyModuleDef_HEAD_INIT,
+    "tsrkit_types._native",
+    "Compiled kernels for the tsrkit_types variable-length integer codec.",
+    -1,
+    native_methods,
+};
+
+PyMODINIT_FUNC
+PyInit__native(void)
+{
+    return PyModule_Create(&native_module);
+}
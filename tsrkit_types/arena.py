@@ -0,0 +1,144 @@
+"""
+Arena decoding: recycle structure instances across decode cycles.
+
+Decoding a block allocates one short-lived object per field and element;
+the allocation churn is what triggers the GC runs whose pauses blow tight
+deadlines. An Arena keeps per-class pools of structure instances: decode
+paths take blanks from the pool instead of allocating, and `reset()`
+returns the whole previous graph to the pools once the caller has dropped
+it. While an arena decode is active, automatic garbage collection is
+suspended so no collection lands mid-block.
+
+Only `structure`-decorated classes are pooled. Immutable leaves (Int,
+Bytes, String) cannot be re-initialized in CPython, so they are not
+recycled — the per-class small-int cache already de-duplicates the common
+ones — and pure Python has no supported way to untrack individual
+instances from the GC, so the arena suspends collection instead.
+
+`reset()` hands every previously decoded instance back for reuse: call it
+only once nothing from the prior cycle is referenced anymore, or live
+objects will be overwritten by later decodes.
+
+Usage:
+    >>> arena = Arena.for_schema(Block, capacity=10_000)
+    >>> for raw in block_stream:
+    ...     block = arena.decode(Block, raw)
+    ...     process(block)
+    ...     arena.reset()
+"""
+
+import gc
+from contextlib import contextmanager
+from typing import Type
+
+from tsrkit_types.itf.codable import _decode_flags
+
+
+def _collect_structure_types(root_type, found: set) -> None:
+    """Every structure class reachable from `root_type`'s schema."""
+    if not isinstance(root_type, type) or root_type in found:
+        return
+    field_types = getattr(root_type, "_field_types", None)
+    if field_types is not None:
+        found.add(root_type)
+        for field_type in field_types.values():
+            _collect_structure_types(field_type, found)
+        return
+    element_type = getattr(root_type, "_element_type", None)
+    if element_type is not None:
+        _collect_structure_types(element_type, found)
+        return
+    key_type = getattr(root_type, "_key_type", None)
+    if key_type is not None:
+        _collect_structure_types(key_type, found)
+        _collect_structure_types(getattr(root_type, "_value_type", None), found)
+
+
+class Arena:
+    """
+    Per-class pools of recyclable structure instances.
+
+    `take()` is called by generated structure decoders when an arena is
+    active on the thread; instances move from the free pool to the live
+    list and back on `reset()`.
+    """
+
+    def __init__(self):
+        self._free = {}
+        self._live = {}
+
+    @classmethod
+    def for_schema(cls, root_type: Type, capacity: int = 0) -> "Arena":
+        """
+        Arena with pools preallocated for every structure class reachable
+        from `root_type` (via structure fields, Seq elements and
+        Dictionary keys/values), `capacity` blanks each.
+        """
+        found = set()
+        _collect_structure_types(root_type, found)
+        arena = cls()
+        for struct_cls in found:
+            arena._free[struct_cls] = [
+                object.__new__(struct_cls) for _ in range(capacity)
+            ]
+            arena._live[struct_cls] = []
+        return arena
+
+    def take(self, struct_cls: Type):
+        """A blank instance of `struct_cls`, pooled when available."""
+        free = self._free.get(struct_cls)
+        if free:
+            instance = free.pop()
+        else:
+            instance = object.__new__(struct_cls)
+        live = self._live.get(struct_cls)
+        if live is None:
+            live = self._live[struct_cls] = []
+        live.append(instance)
+        return instance
+
+    def reset(self) -> None:
+        """
+        Recycle every instance handed out since the last reset.
+
+        The caller asserts nothing from the previous decode cycle is still
+        referenced; recycled instances are re-filled by later decodes.
+        """
+        for struct_cls, live in self._live.items():
+            free = self._free.get(struct_cls)
+            if free is None:
+                free = self._free[struct_cls] = []
+            free.extend(live)
+            live.clear()
+
+    def pooled(self, struct_cls: Type) -> int:
+        """Number of free instances currently pooled for `struct_cls`."""
+        return len(self._free.get(struct_cls, ()))
+
+    def decode(self, type_: Type, buffer, offset: int = 0):
+        """Decode one value with this arena active; returns the value."""
+        with arena_decode(self):
+            value, _ = type_.decode_from(buffer, offset)
+        return value
+
+
+@contextmanager
+def arena_decode(arena: Arena):
+    """
+    Context manager activating `arena` for decodes on the current thread.
+
+    Structure decoders allocate through the arena while active, and
+    automatic garbage collection is suspended so no collection pause
+    lands inside the block.
+    """
+    prev = getattr(_decode_flags, "arena", None)
+    gc_was_enabled = gc.isenabled()
+    _decode_flags.arena = arena
+    if gc_was_enabled:
+        gc.disable()
+    try:
+        yield arena
+    finally:
+        _decode_flags.arena = prev
+        if gc_was_enabled:
+            gc.enable()
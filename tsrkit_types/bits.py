@@ -1,12 +1,23 @@
 from typing import ClassVar, Sequence, Tuple, Union
 
-from tsrkit_types.bytes import Bytes
-from tsrkit_types.integers import Uint
+from tsrkit_types.bytes_common import pack_bits, unpack_bits
 from tsrkit_types.sequences import Seq
 
+# Interned parameterized classes: Bits[n, order] always returns the same class
+_param_cache = {}
+
 
 class Bits(Seq):
-	"""Bits[size, order]"""
+	"""Bits[size, order]
+
+	Bit sequence with packed storage: bits live in an internal bytearray
+	laid out exactly as the wire format (one bit per position, `_order`
+	deciding whether bit 0 maps to the MSB or LSB of each byte), so a
+	2^16-bit bitfield costs 8 KB instead of one Python bool per bit and
+	encode/decode are whole-byte copies. The list-like sequence interface
+	(indexing, append, extend, iteration, equality) is preserved on top of
+	the packed buffer, boxing bits to bool only on access.
+	"""
 	_element_type = bool
 	_min_length: ClassVar[int] = 0
 	_max_length: ClassVar[int] = 2 ** 64
@@ -22,43 +33,276 @@ class Bits(Seq):
 			else:
 				_bo = params
 
-		return type(cls.__class__.__name__, (cls,), {"_min_length": min_l, "_max_length": max_l, "_order": _bo})
-	
+		cache_key = (cls, min_l, max_l, _bo)
+		cached = _param_cache.get(cache_key)
+		if cached is not None:
+			return cached
+
+		new_cls = type(cls.__class__.__name__, (cls,), {"_min_length": min_l, "_max_length": max_l, "_order": _bo})
+		_param_cache[cache_key] = new_cls
+		return new_cls
+
+	# ---------------------------------------------------------------------------- #
+	#                                Packed storage                                 #
+	# ---------------------------------------------------------------------------- #
+
+	def __init__(self, initial: Sequence[bool]):
+		# The inherited list storage stays empty; bits are packed in _buf.
+		super(Seq, self).__init__()
+		self._buf = bytearray()
+		self._bitlen = 0
+		self.extend(initial)
+
+	@classmethod
+	def _from_packed(cls, buf: Union[bytes, bytearray, memoryview], bit_length: int) -> "Bits":
+		"""Construct directly from a packed (wire-layout) buffer — no per-bit work."""
+		byte_count = (bit_length + 7) // 8
+		if len(buf) < byte_count:
+			raise ValueError(
+				f"Bits: packed buffer too small: need {byte_count} bytes for {bit_length} bits, got {len(buf)}"
+			)
+		inst = list.__new__(cls)
+		list.__init__(inst)
+		inst._buf = bytearray(buf)
+		inst._bitlen = bit_length
+		inst._mask_tail()
+		inst._validate_self()
+		return inst
+
+	def _bit_mask(self, index: int) -> int:
+		if self._order == "lsb":
+			return 1 << (index & 7)
+		return 1 << (7 - (index & 7))
+
+	def _mask_tail(self):
+		"""Zero the padding bits past _bitlen so buffer comparisons/copies are exact."""
+		byte_count = (self._bitlen + 7) // 8
+		del self._buf[byte_count:]
+		r = self._bitlen & 7
+		if r:
+			if self._order == "lsb":
+				self._buf[-1] &= (1 << r) - 1
+			else:
+				self._buf[-1] &= (0xFF << (8 - r)) & 0xFF
+
+	def _to_bool_list(self) -> list[bool]:
+		"""Expand the packed buffer to bools via the bulk kernel in bytes_common."""
+		return unpack_bits(self._buf, self._order, self._bitlen)
+
+	# ---------------------------------------------------------------------------- #
+	#                              Sequence interface                               #
+	# ---------------------------------------------------------------------------- #
+
+	def __len__(self) -> int:
+		return self._bitlen
+
+	def __iter__(self):
+		return iter(self._to_bool_list())
+
+	def __reversed__(self):
+		return reversed(self._to_bool_list())
+
+	def __getitem__(self, index):
+		if isinstance(index, slice):
+			return self._to_bool_list()[index]
+		if index < 0:
+			index += self._bitlen
+		if not 0 <= index < self._bitlen:
+			raise IndexError("Bits index out of range")
+		return bool(self._buf[index >> 3] & self._bit_mask(index))
+
+	def __setitem__(self, index, value):
+		if isinstance(index, slice):
+			bits = self._to_bool_list()
+			bits[index] = value
+			self._rebuild(bits)
+			return
+		self._validate(value)
+		if index < 0:
+			index += self._bitlen
+		if not 0 <= index < self._bitlen:
+			raise IndexError("Bits index out of range")
+		if value:
+			self._buf[index >> 3] |= self._bit_mask(index)
+		else:
+			self._buf[index >> 3] &= ~self._bit_mask(index) & 0xFF
+
+	def __delitem__(self, index):
+		bits = self._to_bool_list()
+		del bits[index]
+		self._rebuild(bits)
+
+	def _rebuild(self, bits: list[bool]):
+		for b in bits:
+			self._validate(b)
+		self._buf = bytearray(pack_bits(bits, self._order))
+		self._bitlen = len(bits)
+		self._validate_self()
+
+	def _append_unchecked(self, value: bool):
+		if self._bitlen & 7 == 0:
+			self._buf.append(0)
+		if value:
+			self._buf[self._bitlen >> 3] |= self._bit_mask(self._bitlen)
+		self._bitlen += 1
+
+	def append(self, value: bool):
+		self._validate(value)
+		self._append_unchecked(value)
+		self._validate_self()
+
+	def extend(self, seq: Sequence[bool]):
+		seq = list(seq)
+		for b in seq:
+			self._validate(b)
+		if self._bitlen & 7 == 0:
+			# Byte-aligned: pack the new bits in bulk and append whole bytes
+			self._buf.extend(pack_bits(seq, self._order))
+			self._bitlen += len(seq)
+		else:
+			for b in seq:
+				self._append_unchecked(b)
+		self._validate_self()
+
+	def insert(self, index, value: bool):
+		self._validate(value)
+		bits = self._to_bool_list()
+		bits.insert(index, value)
+		self._rebuild(bits)
+
+	def pop(self, index: int = -1) -> bool:
+		bits = self._to_bool_list()
+		value = bits.pop(index)
+		self._rebuild(bits)
+		return value
+
+	def remove(self, value: bool):
+		bits = self._to_bool_list()
+		bits.remove(value)
+		self._rebuild(bits)
+
+	def clear(self):
+		self._buf = bytearray()
+		self._bitlen = 0
+		self._validate_self()
+
+	def reverse(self):
+		bits = self._to_bool_list()
+		bits.reverse()
+		self._rebuild(bits)
+
+	def sort(self, *, key=None, reverse=False):
+		bits = self._to_bool_list()
+		bits.sort(key=key, reverse=reverse)
+		self._rebuild(bits)
+
+	def __iadd__(self, other):
+		self.extend(other)
+		return self
+
+	def __imul__(self, n):
+		self._rebuild(self._to_bool_list() * n)
+		return self
+
+	def __add__(self, other):
+		# Concatenation boxes to a plain bool list, like slicing and copy()
+		if isinstance(other, Bits):
+			other = other._to_bool_list()
+		if isinstance(other, (list, tuple)):
+			return self._to_bool_list() + list(other)
+		return NotImplemented
+
+	def __radd__(self, other):
+		if isinstance(other, (list, tuple)):
+			return list(other) + self._to_bool_list()
+		return NotImplemented
+
+	def __mul__(self, n):
+		return self._to_bool_list() * n
+
+	__rmul__ = __mul__
+
+	def copy(self) -> list[bool]:
+		return self._to_bool_list()
+
+	def count(self, value) -> int:
+		ones = sum(_POPCOUNT_TABLE[b] for b in self._buf)
+		return ones if value else self._bitlen - ones
+
+	def index(self, value, *args) -> int:
+		return self._to_bool_list().index(value, *args)
+
+	def __contains__(self, value) -> bool:
+		return self.count(value) > 0
+
+	def __eq__(self, other):
+		if isinstance(other, Bits):
+			if self._order == other._order:
+				return self._bitlen == other._bitlen and self._buf == other._buf
+			return self._to_bool_list() == other._to_bool_list()
+		if isinstance(other, (list, tuple)):
+			return self._to_bool_list() == list(other)
+		return NotImplemented
+
+	def __ne__(self, other):
+		result = self.__eq__(other)
+		if result is NotImplemented:
+			return result
+		return not result
+
+	__hash__ = None
+
+	def __repr__(self):
+		return f"{self.__class__.__name__}({self._to_bool_list()})"
 
 	# ---------------------------------------------------------------------------- #
 	#                                  JSON Parse                                  #
 	# ---------------------------------------------------------------------------- #
-	
+
 	def to_json(self) -> str:
-		return Bytes.from_bits(self, bit_order=self._order).hex()
-	
+		# Packed buffer already matches the hex layout (tail bits zeroed)
+		return bytes(self._buf).hex()
+
 	@classmethod
 	def from_json(cls, json_str: str) -> "Bits":
-		bits = Bytes.from_json(json_str).to_bits(bit_order=cls._order)
-		
+		data = bytes.fromhex(json_str.replace("0x", ""))
+
 		# For fixed-length types, trim to exact size
 		if cls._min_length == cls._max_length and cls._min_length > 0:
-			bits = bits[:cls._min_length]
-		
-		return cls(bits)
+			bit_length = cls._min_length
+			data = data[: (bit_length + 7) // 8]
+		else:
+			bit_length = len(data) * 8
+
+		return cls._from_packed(data, bit_length)
 
 	# ---------------------------------------------------------------------------- #
 	#                                 Serialization                                #
 	# ---------------------------------------------------------------------------- #
-	
+
 	def encode_size(self) -> int:
 		# Calculate the number of bytes needed
 		bit_enc = 0
 		# Check if this is a variable-length type (needs length prefix)
 		is_fixed_length = (self._min_length == self._max_length and self._min_length > 0)
 		if not is_fixed_length:
+			from tsrkit_types.integers import Uint
 			bit_enc = Uint(len(self)).encode_size()
 
 		return bit_enc + ((len(self) + 7) // 8)
 
+	def encode_to(self, writer) -> None:
+		# Leaf behavior: bits are not Codable elements, write the packed
+		# buffer in place instead of recursing like Seq does.
+		size = self.encode_size()
+		writer.reserve(size)
+		writer.pos += self.encode_into(writer.buf, writer.pos)
+
 	def encode_into(
 		self, buffer: bytearray, offset: int = 0
 	) -> int:
+		from tsrkit_types.integers import Uint
+
 		total_size = self.encode_size()
 		self._check_buffer_size(buffer, total_size, offset)
 
@@ -80,30 +324,9 @@ class Bits(Seq):
 			if len(self) != self._min_length:
 				raise ValueError(f"Bit sequence length mismatch: expected {self._min_length}, got {len(self)}")
 
-		# Direct bit packing - avoid intermediate conversions
-		bit_count = len(self)
-		byte_count = (bit_count + 7) // 8
-
-		if self._order == "lsb":
-			# LSB: pack bits with bit 0 in LSB position
-			for byte_idx in range(byte_count):
-				val = 0
-				bit_start = byte_idx * 8
-				bit_end = min(bit_start + 8, bit_count)
-				for bit_pos in range(bit_start, bit_end):
-					if self[bit_pos]:
-						val |= (1 << (bit_pos - bit_start))
-				buffer[current_offset + byte_idx] = val
-		else:  # msb
-			# MSB: pack bits with bit 0 in MSB position
-			for byte_idx in range(byte_count):
-				val = 0
-				bit_start = byte_idx * 8
-				bit_end = min(bit_start + 8, bit_count)
-				for bit_pos in range(bit_start, bit_end):
-					if self[bit_pos]:
-						val |= (1 << (7 - (bit_pos - bit_start)))
-				buffer[current_offset + byte_idx] = val
+		# Internal storage is already in wire layout - whole-byte copy
+		byte_count = (self._bitlen + 7) // 8
+		buffer[current_offset : current_offset + byte_count] = self._buf
 
 		return total_size
 
@@ -127,6 +350,7 @@ class Bits(Seq):
 			DecodeError: If buffer too small or bit_length not specified
 		"""
 		from tsrkit_types.constants import MAX_BITS_LENGTH
+		from tsrkit_types.integers import Uint
 
 		# Check if this is a fixed-length Bits type
 		is_fixed_length = (cls._min_length == cls._max_length and cls._min_length > 0)
@@ -169,25 +393,24 @@ class Bits(Seq):
 		byte_count = (_len + 7) // 8
 		cls._check_buffer_size(buffer, byte_count, offset)
 
-		# Direct bit unpacking - avoid intermediate conversions
-		result_bits = []
-
-		if cls._order == "lsb":
-			# LSB: unpack bits with bit 0 in LSB position
-			for byte_idx in range(byte_count):
-				byte_val = buffer[offset + byte_idx]
-				for bit_offset in range(8):
-					if len(result_bits) >= _len:
-						break
-					result_bits.append(bool((byte_val >> bit_offset) & 1))
-		else:  # msb
-			# MSB: unpack bits with bit 0 in MSB position
-			for byte_idx in range(byte_count):
-				byte_val = buffer[offset + byte_idx]
-				for bit_offset in range(8):
-					if len(result_bits) >= _len:
-						break
-					result_bits.append(bool((byte_val >> (7 - bit_offset)) & 1))
+		# Whole-byte copy into packed storage - no per-bit unpacking
+		result = cls._from_packed(buffer[offset : offset + byte_count], _len)
 
 		total_bytes_read = offset + byte_count - original_offset
-		return cls(result_bits), total_bytes_read
\ No newline at end of file
+		return result, total_bytes_read
+
+	@classmethod
+	def decode_size_from(
+		cls, buffer: Union[bytes, bytearray, memoryview], offset: int = 0
+	) -> int:
+		"""Skip length of the encoding at `offset` without unpacking bits."""
+		from tsrkit_types.integers import Uint
+
+		if cls._min_length == cls._max_length and cls._min_length > 0:
+			return (cls._min_length + 7) // 8
+		_len, size = Uint.decode_from(buffer, offset)
+		return size + (int(_len) + 7) // 8
+
+
+# Byte value -> number of set bits
+_POPCOUNT_TABLE = [bin(i).count("1") for i in range(256)]
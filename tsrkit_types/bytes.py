@@ -1,13 +1,128 @@
 import abc
 from typing import Tuple, Union, ClassVar
 from tsrkit_types.integers import Uint
-from tsrkit_types.itf.codable import Codable
+from tsrkit_types.itf.codable import Codable, zero_copy_enabled
 from tsrkit_types.bytes_common import BytesMixin
 
 
+class BytesView:
+    """
+    Zero-copy stand-in for a decoded Bytes value.
+
+    Holds a memoryview into the original input buffer instead of copying the
+    payload out. Read paths (length, indexing, equality, hex/JSON, re-encode)
+    operate on the view directly; anything else materializes an owned Bytes
+    via `freeze()` (cached) and delegates to it. Produced by
+    `Bytes.decode_from` inside a `zero_copy_decode()` block.
+    """
+
+    __slots__ = ("_cls", "_view", "_frozen")
+
+    def __init__(self, cls, view: memoryview):
+        self._cls = cls
+        self._view = view
+        self._frozen = None
+
+    def freeze(self) -> "Bytes":
+        """Materialize (and cache) an owned Bytes copy of the viewed payload."""
+        if self._frozen is None:
+            self._frozen = self._cls(bytes(self._view))
+        return self._frozen
+
+    def release(self) -> "Bytes":
+        """
+        Materialize the payload and detach from the source buffer.
+
+        After this the source (e.g. an mmap about to close) holds no
+        exported pointers from this view; reads keep working against the
+        owned copy. Returns the frozen Bytes.
+        """
+        frozen = self.freeze()
+        self._view.release()
+        self._view = memoryview(frozen)
+        return frozen
+
+    def __bytes__(self) -> bytes:
+        return bytes(self._view)
+
+    def __len__(self) -> int:
+        return len(self._view)
+
+    def __getitem__(self, index):
+        return self._view[index]
+
+    def __iter__(self):
+        return iter(self._view)
+
+    def __eq__(self, other):
+        if isinstance(other, BytesView):
+            return self._view == other._view
+        if isinstance(other, (bytes, bytearray, memoryview)):
+            return self._view == other
+        return NotImplemented
+
+    def __hash__(self):
+        return hash(bytes(self._view))
+
+    def hex(self) -> str:
+        return self._view.hex()
+
+    def to_json(self) -> str:
+        return self._view.hex()
+
+    def __repr__(self):
+        return f"BytesView({self._cls.__name__}, {self._view.hex()})"
+
+    # ------------------------------ Serialization ------------------------------ #
+
+    def encode_size(self) -> int:
+        if self._cls._length is None:
+            return Uint(len(self._view)).encode_size() + len(self._view)
+        return self._cls._length
+
+    def encode_into(self, buf: bytearray, offset: int = 0) -> int:
+        current_offset = offset
+        _len = self._cls._length
+        if _len is None:
+            _len = len(self._view)
+            if _len < 128:
+                buf[current_offset] = _len
+                current_offset += 1
+            else:
+                current_offset += Uint(_len).encode_into(buf, current_offset)
+        buf[current_offset:current_offset + _len] = self._view
+        current_offset += _len
+        return current_offset - offset
+
+    def encode(self) -> bytes:
+        size = self.encode_size()
+        buffer = bytearray(size)
+        written = self.encode_into(buffer)
+        return bytes(buffer[:written])
+
+    def __getattr__(self, name):
+        # Everything not handled on the view (to_bits, slice_bits, ...)
+        # works on the materialized Bytes.
+        return getattr(self.freeze(), name)
+
+
+# Views satisfy the Codable interface so containers re-encode them as-is
+Codable.register(BytesView)
+
+
+# Interned parameterized classes: Bytes[N] always returns the same class object
+_param_cache = {}
+
+
 class BytesCheckMeta(abc.ABCMeta):
     """Meta class to check if the instance is a bytes with the same key and value types"""
     def __instancecheck__(cls, instance):
+        # Fast path: parameterized classes are interned
+        if type(instance) is cls or issubclass(type(instance), cls):
+            return True
+        # Zero-copy views stand in for the Bytes class they were decoded as
+        if isinstance(instance, BytesView):
+            return str(getattr(cls, "_length", None)) == str(getattr(instance._cls, "_length", None))
         # TODO - This needs more false positive testing
         _matches_length = str(getattr(cls, "_length", None)) == str(getattr(instance, "_length", None))
         return isinstance(instance, bytes) and _matches_length
@@ -24,9 +139,17 @@ class Bytes(bytes, Codable, BytesMixin, metaclass=BytesCheckMeta):
         if params and params > 0:
             _len = params
             name = f"ByteArray{_len}"
-        return type(name, (cls,), {
+
+        cache_key = (cls, _len)
+        cached = _param_cache.get(cache_key)
+        if cached is not None:
+            return cached
+
+        new_cls = type(name, (cls,), {
             "_length": _len,
         })
+        _param_cache[cache_key] = new_cls
+        return new_cls
 
     # Bit conversion methods inherited from BytesMixin
     
@@ -76,10 +199,23 @@ class Bytes(bytes, Codable, BytesMixin, metaclass=BytesCheckMeta):
         if len(buffer[current_offset:current_offset+_len]) < _len:
             raise TypeError("Insufficient buffer")
 
+        if zero_copy_enabled():
+            # Reference the input buffer instead of copying the payload
+            view = memoryview(buffer)[current_offset:current_offset+_len]
+            return BytesView(cls, view), current_offset + _len - offset
+
         result = (cls(buffer[current_offset:current_offset+_len]), current_offset + _len - offset)
 
         return result
 
+    @classmethod
+    def decode_size_from(cls, buffer: Union[bytes, bytearray, memoryview], offset: int = 0) -> int:
+        """Skip length of the encoding at `offset` without materializing the payload."""
+        if cls._length is not None:
+            return cls._length
+        _len, size = Uint.decode_from(buffer, offset)
+        return size + int(_len)
+
     def __deepcopy__(self, memo):
         # immutable; safe to reuse or create a new same-typed instance
         existing = memo.get(id(self))
@@ -2,94 +2,106 @@
 Common functionality for Bytes and ByteArray types.
 """
 
-from typing import Union
-
-# Global lookup tables for maximum performance - initialized once
-_BYTE_TO_BITS_MSB = []
-_BITS_TO_BYTE_MSB = {}
-_TABLES_INITIALIZED = False
-
-def _init_lookup_tables():
-    """Initialize lookup tables once for optimal performance."""
-    global _BYTE_TO_BITS_MSB, _BITS_TO_BYTE_MSB, _TABLES_INITIALIZED
-    if not _TABLES_INITIALIZED:
-        for i in range(256):
-            # Convert byte to 8 bits (MSB first)
-            bits = [(i >> (7 - j)) & 1 for j in range(8)]
-            _BYTE_TO_BITS_MSB.append(bits)
-            # Reverse lookup: bits tuple to byte value
-            _BITS_TO_BYTE_MSB[tuple(bits)] = i
-        _TABLES_INITIALIZED = True
+from typing import Sequence, Union
+
+# Byte value -> byte with bit order reversed (for lsb<->msb conversion)
+_BIT_REVERSE_TABLE = bytes(
+    int(f"{i:08b}"[::-1], 2) for i in range(256)
+)
+
+
+def pack_bits(bits: Sequence[bool], bit_order: str = "msb") -> bytes:
+    """
+    Pack a sequence of bools into bytes in bulk.
+
+    Builds one big int from a 0/1 string and converts it with to_bytes,
+    so no per-byte tuple lookups or per-bit shifting happen in Python.
+    """
+    validate_bit_order(bit_order)
+    n = len(bits)
+    if n == 0:
+        return b""
+    s = "".join("1" if b else "0" for b in bits)
+    pad = -n % 8
+    if pad:
+        s += "0" * pad
+    data = int(s, 2).to_bytes((n + pad) // 8, "big")
+    if bit_order == "lsb":
+        data = data.translate(_BIT_REVERSE_TABLE)
+    return data
+
+
+def unpack_bits(
+    data: Union[bytes, bytearray, memoryview],
+    bit_order: str = "msb",
+    bit_length: int = None,
+) -> list[bool]:
+    """
+    Expand bytes to a list of bools in O(bytes).
+
+    The whole buffer is formatted as one binary string via int.from_bytes,
+    avoiding the eight intermediate objects per byte that per-byte table
+    lookups would create. `bit_length` trims trailing padding bits.
+    """
+    validate_bit_order(bit_order)
+    if bit_length is None:
+        bit_length = len(data) * 8
+    if bit_length == 0:
+        return []
+    if bit_order == "lsb":
+        data = bytes(data).translate(_BIT_REVERSE_TABLE)
+    s = format(int.from_bytes(data, "big"), f"0{len(data) * 8}b")
+    return [c == "1" for c in s[:bit_length]]
+
+
+def bytes_to_bits_packed(
+    data: Union[bytes, bytearray, memoryview], bit_order: str = "msb"
+):
+    """
+    Reinterpret bytes as a packed Bits value without any per-bit work.
+
+    Bits stores its bits in wire layout for both orders, so the bytes are
+    the packed representation already — this is a buffer copy, not a
+    conversion. Use this instead of to_bits() when the consumer can work
+    with Bits directly.
+    """
+    from tsrkit_types.bits import Bits
+
+    validate_bit_order(bit_order)
+    return Bits[bit_order]._from_packed(data, len(data) * 8)
 
 
 class BytesMixin:
     """Mixin providing common functionality for bytes-like types."""
-    
+
     @classmethod
-    def from_bits(cls, bits: list[bool], bit_order: str = "msb"):
-        """Convert a list of bits to bytes with specified bit order."""
-        # Fast path for MSB (most common case) using lookup tables
-        if bit_order == "msb":
-            _init_lookup_tables()
-            
-            # Convert and pad to multiple of 8
-            int_bits = [int(bool(b)) for b in bits]
-            pad = (8 - len(int_bits) % 8) % 8
-            int_bits.extend([0] * pad)
-            
-            result = []
-            for i in range(0, len(int_bits), 8):
-                byte_bits = tuple(int_bits[i:i+8])
-                result.append(_BITS_TO_BYTE_MSB[byte_bits])
-            return cls(bytes(result))
-        
-        # LSB implementation
-        elif bit_order == "lsb":
-            int_bits = [int(bool(b)) for b in bits]
-            pad = (8 - len(int_bits) % 8) % 8
-            int_bits.extend([0] * pad)
-            
-            result = []
-            for i in range(0, len(int_bits), 8):
-                byte_bits = int_bits[i:i + 8]
-                val = 0
-                for bit in reversed(byte_bits):
-                    val = (val << 1) | bit
-                result.append(val)
-            return cls(bytes(result))
-        else:
-            raise ValueError(f"Unknown bit_order: {bit_order}")
+    def from_bits(cls, bits: Sequence[bool], bit_order: str = "msb"):
+        """Convert a sequence of bits to bytes with specified bit order."""
+        from tsrkit_types.bits import Bits
+
+        # Packed Bits in the same order are already byte-exact
+        if isinstance(bits, Bits) and bits._order == bit_order:
+            return cls(bytes(bits._buf))
+        return cls(pack_bits(bits, bit_order))
 
     def to_bits(self, bit_order: str = "msb") -> list[bool]:
         """Convert bytes to a list of bits with specified bit order."""
-        # Fast path for MSB using lookup table
-        if bit_order == "msb":
-            _init_lookup_tables()
-            
-            result = []
-            for byte in self:
-                result.extend(_BYTE_TO_BITS_MSB[byte])
-            return [bool(b) for b in result]
-        
-        # LSB implementation
-        elif bit_order == "lsb":
-            bits = []
-            for byte in self:
-                bits.extend([bool((byte >> i) & 1) for i in range(8)])
-            return bits
-        else:
-            raise ValueError(f"Unknown bit_order: {bit_order}")
-    
+        return unpack_bits(self, bit_order)
+
+    def to_bits_packed(self, bit_order: str = "msb"):
+        """Convert bytes to a packed Bits value — no per-bit materialization."""
+        return bytes_to_bits_packed(bytes(self), bit_order)
+
     def to_json(self):
         """Convert bytes to hex string for JSON serialization."""
         return self.hex()
-    
+
     @classmethod
     def from_json(cls, data: str):
         """Create instance from hex string."""
         data = data.replace("0x", "")
         return cls(bytes.fromhex(data))
-    
+
     def __str__(self):
         return f"{self.__class__.__name__}({self.hex()})"
 
@@ -97,38 +109,26 @@ class BytesMixin:
         """Extract bit slice efficiently without converting entire byte array."""
         if start_bit >= end_bit:
             return []
-        
+
         start_byte = start_bit // 8
         end_byte = (end_bit - 1) // 8 + 1
-        start_bit_offset = start_bit % 8
-        
+
         if start_byte >= len(self):
             return [False] * (end_bit - start_bit)
-        
-        # Extract relevant bytes and convert only what we need
-        relevant_bytes = self[start_byte:min(end_byte, len(self))]
-        
-        # Use global lookup table for optimal performance
-        _init_lookup_tables()
-        
-        result = []
-        for byte in relevant_bytes:
-            result.extend(_BYTE_TO_BITS_MSB[byte])
-        
-        # Slice to exact range
-        local_start = start_bit_offset if start_byte < len(self) else 0
-        local_end = len(result) if end_byte > len(self) else (end_bit - start_byte * 8)
-        
-        bits = result[local_start:local_end]
-        
+
+        # Bulk-expand only the bytes covering the range, then trim
+        chunk = bytes(self[start_byte:min(end_byte, len(self))])
+        expanded = unpack_bits(chunk)
+        bits = expanded[start_bit - start_byte * 8:end_bit - start_byte * 8]
+
         # Pad with False if we ran out of data
         if len(bits) < (end_bit - start_bit):
             bits.extend([False] * (end_bit - start_bit - len(bits)))
-        
-        return [bool(b) for b in bits]
+
+        return bits
 
 
 def validate_bit_order(bit_order: str) -> None:
     """Validate bit order parameter."""
     if bit_order not in ("msb", "lsb"):
-        raise ValueError(f"Unknown bit_order: {bit_order}. Must be 'msb' or 'lsb'") 
\ No newline at end of file
+        raise ValueError(f"Unknown bit_order: {bit_order}. Must be 'msb' or 'lsb'")
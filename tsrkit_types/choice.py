@@ -5,6 +5,9 @@ from tsrkit_types.itf.codable import Codable
 
 ChoiceType = Union[Tuple[Optional[str], type], type]
 
+# Interned parameterized classes: Choice[T1, T2] always returns the same class
+_param_cache = {}
+
 class Choice(Codable):
     """
     Can either be defined as:
@@ -35,13 +38,35 @@ class Choice(Codable):
     _choice_key: Optional[str]
     _value: Any
 
+    @classmethod
+    def _dispatch(cls) -> Tuple[Tuple[Optional[str]], Tuple[type], dict, dict]:
+        """
+        Per-class dispatch tables, built once on first use.
+
+        Returns (keys, types, variant_index, type_key): the key/type tuples
+        (no longer rebuilt per access), a (key, type) -> discriminator map
+        for O(1) encode, and an exact-type -> default-key map for O(1) set().
+        """
+        tables = cls.__dict__.get("_dispatch_tables")
+        if tables is None:
+            keys = tuple(opt[0] for opt in cls._opt_types)
+            types = tuple(opt[1] for opt in cls._opt_types)
+            variant_index = {}
+            type_key = {}
+            for i, (key, opt_type) in enumerate(cls._opt_types):
+                variant_index.setdefault((key, opt_type), i)
+                type_key.setdefault(opt_type, key)
+            tables = (keys, types, variant_index, type_key)
+            cls._dispatch_tables = tables
+        return tables
+
     @property
     def _choice_types(self) -> Tuple[type]:
-        return tuple(self._choice[1] for self._choice in self._opt_types)
-    
+        return self._dispatch()[1]
+
     @property
     def _choice_keys(self) -> Tuple[Optional[str]]:
-        return tuple(self._choice[0] for self._choice in self._opt_types)
+        return self._dispatch()[0]
 
     def __class_getitem__(cls, opt_t: Union[Tuple[type], type]):
         _opt_types = []
@@ -51,7 +76,15 @@ class Choice(Codable):
             for op in opt_t:
                 _opt_types.append((None, op))
         name = f"Choice[{'/'.join(op[1].__class__.__name__ for op in _opt_types)}]"
-        return type(name, (Choice,), {"_opt_types": tuple(_opt_types)})
+
+        cache_key = (cls, tuple(_opt_types))
+        cached = _param_cache.get(cache_key)
+        if cached is not None:
+            return cached
+
+        new_cls = type(name, (Choice,), {"_opt_types": tuple(_opt_types)})
+        _param_cache[cache_key] = new_cls
+        return new_cls
     
     def __init_subclass__(cls, **kwargs):
         super().__init_subclass__(**kwargs)
@@ -78,13 +111,17 @@ class Choice(Codable):
         return other == self._value
 
     def set(self, value: Any, key: Optional[str] = None):
-        if not isinstance(value, self._choice_types):
-            raise TypeError(f"{value!r} is not a {self._choice_types}")
-        
-        key = key or tuple(self._choice[0] for self._choice in self._opt_types if isinstance(value, self._choice[1]))[0]
-        if key not in self._choice_keys:
-            raise ValueError(f"Key {key!r} not in {self._choice_keys}")
-        
+        keys, types, _, type_key = self._dispatch()
+        if not isinstance(value, types):
+            raise TypeError(f"{value!r} is not a {types}")
+
+        if key is None:
+            # O(1) for exactly-typed values; isinstance scan only for subclasses
+            key = type_key.get(type(value)) if type(value) in type_key else \
+                tuple(k for k, t in self._opt_types if isinstance(value, t))[0]
+        if key not in keys:
+            raise ValueError(f"Key {key!r} not in {keys}")
+
         self._choice_key = key
         self._value = value
 
@@ -117,20 +154,38 @@ class Choice(Codable):
             discriminator_size = Uint(num_types).encode_size()
         return discriminator_size + self._value.encode_size()
 
+    def _discriminator(self) -> int:
+        """Index of the current (key, type) variant — one dict lookup."""
+        _, _, variant_index, _ = self._dispatch()
+        i = variant_index.get((self._choice_key, type(self._value)))
+        if i is None:
+            # Subclass instances fall back to the isinstance scan
+            for i, (key, choice_type) in enumerate(self._opt_types):
+                if self._choice_key == key and isinstance(self._value, choice_type):
+                    return i
+            raise ValueError(f"Value {self._value} with key {self._choice_key} is not a valid choice")
+        return i
+
+    def encode_to(self, writer) -> None:
+        # Single pass: write the discriminator, then recurse into the value
+        i = self._discriminator()
+        if i < 128:  # Single byte encoding
+            writer.reserve(1)
+            writer.buf[writer.pos] = i
+            writer.pos += 1
+        else:
+            Uint(i).encode_to(writer)
+        self._value.encode_to(writer)
+
     def encode_into(self, buf: bytearray, offset: int = 0) -> int:
         current_offset = offset
-        # Find the index of the (key, type) pair that matches our current choice
-        for i, (key, choice_type) in enumerate(self._opt_types):
-            if self._choice_key == key and isinstance(self._value, choice_type):
-                # Avoid creating Uint object for small indices
-                if i < 128:  # Single byte encoding
-                    buf[current_offset] = i
-                    current_offset += 1
-                else:
-                    current_offset += Uint(i).encode_into(buf, current_offset)
-                break
+        i = self._discriminator()
+        # Avoid creating Uint object for small indices
+        if i < 128:  # Single byte encoding
+            buf[current_offset] = i
+            current_offset += 1
         else:
-            raise ValueError(f"Value {self._value} with key {self._choice_key} is not a valid choice")
+            current_offset += Uint(i).encode_into(buf, current_offset)
         current_offset += self._value.encode_into(buf, current_offset)
         return current_offset - offset
 
@@ -138,7 +193,12 @@ class Choice(Codable):
     def decode_from(
         cls, buffer: Union[bytes, bytearray, memoryview], offset: int = 0
     ) -> Tuple[Any, int]:
-        tag, tag_size = Uint.decode_from(buffer, offset)
-        value, val_size = cls._opt_types[tag][1].decode_from(buffer, offset+tag_size)
+        # Avoid the Uint round-trip for the common single-byte discriminator
+        if len(cls._opt_types) <= 128 and len(buffer) > offset and buffer[offset] < 128:
+            tag, tag_size = buffer[offset], 1
+        else:
+            tag, tag_size = Uint.decode_from(buffer, offset)
+        key, opt_type = cls._opt_types[tag]
+        value, val_size = opt_type.decode_from(buffer, offset + tag_size)
 
-        return cls(value, key=cls._opt_types[tag][0]), tag_size+val_size
+        return cls(value, key=key), tag_size + val_size
@@ -0,0 +1,274 @@
+"""
+Structural delta codec between two versions of a value.
+
+Re-encoding a large state tree every block is O(state) even when almost
+nothing changed. `encode_delta(old, new)` walks the two values together
+and emits a compact patch — paths into the tree plus re-encoded changed
+subtrees — so the per-block cost is O(changes). `apply_delta(old, patch)`
+replays the patch onto a decoded value, mutating containers and
+structures in place where the type allows it.
+
+Recursion covers `structure`-decorated classes (by field), Seq (by
+index, with a resize op for length changes) and Dictionary (set/delete
+by key, reusing the per-entry encoding cache on the encode side). Any
+other changed value, or a value whose type changed, is shipped as one
+re-encoded subtree; that includes Bits, whose elements are plain bools
+rather than codables. Patching raw encoded buffers byte-for-byte is only
+possible for all-fixed layouts — variable-length encodings shift every
+later offset — so buffer patching is decode, apply, re-encode.
+
+Usage:
+    >>> patch = encode_delta(old_state, new_state)
+    >>> restored = apply_delta(old_state, patch, type(old_state))
+    >>> restored == new_state
+    True
+"""
+
+from typing import Any, Tuple, Union
+
+from tsrkit_types.bits import Bits
+from tsrkit_types.bool import Bool
+from tsrkit_types.dictionary import Dictionary
+from tsrkit_types.integers import Uint
+from tsrkit_types.itf.codable import _acquire_writer, _release_writer
+from tsrkit_types.sequences import Seq
+
+# Path segment kinds
+_SEG_FIELD = 0  # structure field, by declaration index
+_SEG_INDEX = 1  # sequence element index
+_SEG_KEY = 2    # dictionary key, length-prefixed encoded key
+
+# Operation kinds
+_OP_REPLACE = 0  # re-encoded subtree at the path
+_OP_DELETE = 1   # remove the dictionary key the path ends in
+_OP_RESIZE = 2   # change a sequence's length; payload carries appended elements
+
+
+def _is_structure(value) -> bool:
+    return hasattr(type(value), "_field_types")
+
+
+def _values_equal(a, b) -> bool:
+    # `is` first: shared small-int cache instances short-circuit here.
+    if a is b:
+        return True
+    # Bool has no __eq__, so == degrades to identity; compare by value or
+    # every Bool field would ship in every patch.
+    if isinstance(a, Bool) and isinstance(b, Bool):
+        return bool(a) == bool(b)
+    return a == b
+
+
+def _diff(old, new, path, ops) -> None:
+    """Append (path, op, payload) tuples describing how to turn old into new."""
+    if _values_equal(old, new):
+        return
+
+    if type(old) is not type(new):
+        ops.append((path, _OP_REPLACE, new))
+        return
+
+    if isinstance(old, Dictionary):
+        for key in old:
+            if key not in new:
+                ops.append((path + ((_SEG_KEY, key),), _OP_DELETE, None))
+        for key, value in new.items():
+            old_value = old.get(key)
+            if old_value is None:
+                ops.append((path + ((_SEG_KEY, key),), _OP_REPLACE, value))
+            elif not _values_equal(old_value, value):
+                _diff(old_value, value, path + ((_SEG_KEY, key),), ops)
+        return
+
+    if isinstance(old, Bits):
+        # Bits subclasses Seq but its elements are plain bools, not codable
+        # subtrees, and its storage is packed: ship the whole value.
+        ops.append((path, _OP_REPLACE, new))
+        return
+
+    if isinstance(old, Seq):
+        common = min(len(old), len(new))
+        for i in range(common):
+            if not _values_equal(old[i], new[i]):
+                _diff(old[i], new[i], path + ((_SEG_INDEX, i),), ops)
+        if len(new) != len(old):
+            ops.append((path, _OP_RESIZE, (len(new), list(new[common:]))))
+        return
+
+    if _is_structure(old):
+        for index, name in enumerate(type(old)._field_types):
+            a, b = getattr(old, name), getattr(new, name)
+            if not _values_equal(a, b):
+                _diff(a, b, path + ((_SEG_FIELD, index),), ops)
+        return
+
+    ops.append((path, _OP_REPLACE, new))
+
+
+def _encode_value(value, writer) -> None:
+    """Length-prefixed encoding of a subtree, reusing cached entry bytes for dicts."""
+    Uint(value.encode_size()).encode_to(writer)
+    value.encode_to(writer)
+
+
+def encode_delta(old, new) -> bytes:
+    """
+    Patch turning `old` into `new`, as bytes.
+
+    Both values must be instances of the same codable type. An empty
+    patch (no changes) is one zero byte.
+    """
+    ops = []
+    _diff(old, new, (), ops)
+
+    writer = _acquire_writer()
+    try:
+        Uint(len(ops)).encode_to(writer)
+        for path, op, payload in ops:
+            Uint(len(path)).encode_to(writer)
+            for kind, segment in path:
+                writer.write(bytes([kind]))
+                if kind == _SEG_KEY:
+                    Uint(segment.encode_size()).encode_to(writer)
+                    segment.encode_to(writer)
+                else:
+                    Uint(segment).encode_to(writer)
+            writer.write(bytes([op]))
+            if op == _OP_REPLACE:
+                _encode_value(payload, writer)
+            elif op == _OP_RESIZE:
+                new_len, tail = payload
+                Uint(new_len).encode_to(writer)
+                Uint(len(tail)).encode_to(writer)
+                for item in tail:
+                    item.encode_to(writer)
+        return writer.getvalue()
+    finally:
+        _release_writer(writer)
+
+
+def _walk(root, root_type, path) -> Tuple[Any, Any, Tuple[int, Any], Any]:
+    """
+    Follow all but the last path segment from the root.
+
+    Returns (parent, parent_type, last_segment, leaf_type) where
+    last_segment locates the value to change inside parent. Descending
+    through a dictionary drops that key's cached entry bytes: the value
+    behind it is about to be mutated without passing through __setitem__.
+    """
+    value, value_type = root, root_type
+    for kind, segment in path[:-1]:
+        if kind == _SEG_FIELD:
+            name, value_type = list(value_type._field_types.items())[segment]
+            value = getattr(value, name)
+        elif kind == _SEG_INDEX:
+            value_type = value_type._element_type
+            value = value[segment]
+        else:
+            value_type = value_type._value_type
+            if isinstance(value, Dictionary):
+                value._entry_cache.pop(segment, None)
+            value = value[segment]
+    kind, segment = path[-1]
+    if kind == _SEG_FIELD:
+        _, leaf_type = list(value_type._field_types.items())[segment]
+    elif kind == _SEG_INDEX:
+        leaf_type = value_type._element_type
+    else:
+        leaf_type = value_type._value_type
+    return value, value_type, (kind, segment), leaf_type
+
+
+def apply_delta(old, delta: Union[bytes, bytearray, memoryview], value_type=None):
+    """
+    Replay a patch from `encode_delta` onto `old` and return the result.
+
+    Containers and structure fields are mutated in place; the returned
+    value differs from `old` only when the patch replaces the root.
+    `value_type` defaults to `type(old)` and is the type the delta was
+    computed against.
+    """
+    if value_type is None:
+        value_type = type(old)
+
+    offset = 0
+    op_count, size = Uint.decode_from(delta, offset)
+    offset += size
+    root = old
+
+    for _ in range(int(op_count)):
+        path_len, size = Uint.decode_from(delta, offset)
+        offset += size
+        path = []
+        parent_type = value_type
+        for _ in range(int(path_len)):
+            kind = delta[offset]
+            offset += 1
+            if kind == _SEG_KEY:
+                key_size, size = Uint.decode_from(delta, offset)
+                offset += size
+                # Key type is fixed by the dictionary the path has reached
+                key_owner = parent_type
+                for k, seg in path:
+                    if k == _SEG_FIELD:
+                        key_owner = list(key_owner._field_types.values())[seg]
+                    elif k == _SEG_INDEX:
+                        key_owner = key_owner._element_type
+                    else:
+                        key_owner = key_owner._value_type
+                segment, _ = key_owner._key_type.decode_from(delta, offset)
+                offset += int(key_size)
+            else:
+                segment, size = Uint.decode_from(delta, offset)
+                offset += size
+                segment = int(segment)
+            path.append((kind, segment))
+
+        op = delta[offset]
+        offset += 1
+
+        if op == _OP_REPLACE:
+            payload_size, size = Uint.decode_from(delta, offset)
+            offset += size
+            if not path:
+                root, _ = value_type.decode_from(delta, offset)
+                offset += int(payload_size)
+                continue
+            parent, _, (kind, segment), leaf_type = _walk(root, value_type, tuple(path))
+            new_value, _ = leaf_type.decode_from(delta, offset)
+            offset += int(payload_size)
+            if kind == _SEG_FIELD:
+                name = list(type(parent)._field_types)[segment]
+                object.__setattr__(parent, name, new_value)
+            elif kind == _SEG_INDEX:
+                list.__setitem__(parent, segment, new_value)
+            else:
+                parent[segment] = new_value
+        elif op == _OP_DELETE:
+            parent, _, (kind, segment), _ = _walk(root, value_type, tuple(path))
+            del parent[segment]
+        elif op == _OP_RESIZE:
+            new_len, size = Uint.decode_from(delta, offset)
+            offset += size
+            tail_count, size = Uint.decode_from(delta, offset)
+            offset += size
+            if path:
+                parent, _, (kind, segment), seq_type = _walk(root, value_type, tuple(path))
+                if kind == _SEG_FIELD:
+                    target = getattr(parent, list(type(parent)._field_types)[segment])
+                else:
+                    if kind == _SEG_KEY and isinstance(parent, Dictionary):
+                        parent._entry_cache.pop(segment, None)
+                    target = parent[segment]
+            else:
+                target, seq_type = root, value_type
+            elem_type = seq_type._element_type
+            del target[int(new_len):]
+            for _ in range(int(tail_count)):
+                item, size = elem_type.decode_from(delta, offset)
+                offset += size
+                list.append(target, item)
+        else:
+            raise ValueError(f"Unknown delta op {op}")
+
+    return root
@@ -1,4 +1,5 @@
 import abc
+from bisect import bisect_left, insort
 from typing import (
     Generic,
     Mapping,
@@ -13,15 +14,27 @@ from typing import (
 )
 
 from tsrkit_types.integers import Uint
-from tsrkit_types.itf.codable import Codable
+from tsrkit_types.itf.codable import (
+    Codable,
+    trusted_enabled,
+    _acquire_writer,
+    _release_writer,
+)
 
 K = TypeVar("K", bound=Codable)
 V = TypeVar("V", bound=Codable)
 
 
+# Interned parameterized classes: Dictionary[K, V] always returns the same class
+_param_cache = {}
+
+
 class DictCheckMeta(abc.ABCMeta):
     """Meta class to check if the instance is a dictionary with the same key and value types"""
     def __instancecheck__(cls, instance):
+        # Fast path: parameterized classes are interned
+        if type(instance) is cls or issubclass(type(instance), cls):
+            return True
         # TODO - This needs more false positive testing
         _matches_key_type = str(getattr(cls, "_key_type", None)) == str(getattr(instance, "_key_type", None))
         _matches_value_type = str(getattr(cls, "_value_type", None)) == str(getattr(instance, "_value_type", None))
@@ -53,18 +66,35 @@ class Dictionary(dict, Codable, Generic[K, V], metaclass=DictCheckMeta):
     _key_name: Optional[str]
     _value_name: Optional[str]
 
-    # Cache for sorted keys to avoid sorting on every encode
+    # Cache for sorted keys, maintained incrementally across mutations
     _sorted_keys_cache: Optional[list]
     _dirty: bool
 
+    # Per-entry encoded bytes (key + value), so untouched entries are not
+    # re-encoded. Only populated when the value type is immutable (int-,
+    # str- or bytes-backed): mutable values (structures, sequences) can be
+    # changed in place without going through __setitem__, which would serve
+    # stale bytes, so they are re-encoded on every encode.
+    _entry_cache: Dict[K, bytes]
+
+    # Lazily computed per parameterized class by _values_cacheable()
+    _cache_entries: Optional[bool] = None
+
     def __class_getitem__(cls, params):
         if len(params) >= 2:
-            return type(cls.__name__, (cls,), {
+            cache_key = (cls,) + tuple(params)
+            cached = _param_cache.get(cache_key)
+            if cached is not None:
+                return cached
+
+            new_cls = type(cls.__name__, (cls,), {
                 "_key_type": params[0],
                 "_value_type": params[1],
                 "_key_name": params[2] if len(params) == 4 else None,
                 "_value_name": params[3] if len(params) == 4 else None,
             })
+            _param_cache[cache_key] = new_cls
+            return new_cls
         else:
             raise ValueError("Dictionary must be initialized with types as such - Dictionary[K, V, key_name(optional), value_name(optional)]")
 
@@ -72,6 +102,7 @@ class Dictionary(dict, Codable, Generic[K, V], metaclass=DictCheckMeta):
         super().__init__()
         self._sorted_keys_cache = None
         self._dirty = True
+        self._entry_cache = {}
         self.update(initial or {})
 
     def _validate(self, key: K, value: V):
@@ -83,19 +114,73 @@ class Dictionary(dict, Codable, Generic[K, V], metaclass=DictCheckMeta):
     def __setitem__(self, key: K, value: V) -> None:
         """Set value for key."""
         self._validate(key, value)
+        if key not in self and self._sorted_keys_cache is not None and not self._dirty:
+            # Incremental maintenance: insert into the sorted cache instead of
+            # throwing it away and re-sorting everything on the next encode
+            try:
+                insort(self._sorted_keys_cache, key)
+            except TypeError:
+                self._sorted_keys_cache = None
+                self._dirty = True
         super().__setitem__(key, value)
-        self._dirty = True
+        self._entry_cache.pop(key, None)
+
+    def _forget_key(self, key: K) -> None:
+        """Drop a removed key from the sorted-key and per-entry caches."""
+        self._entry_cache.pop(key, None)
+        cache = self._sorted_keys_cache
+        if cache is None:
+            return
+        try:
+            i = bisect_left(cache, key)
+            if i < len(cache) and cache[i] == key:
+                del cache[i]
+            else:
+                cache.remove(key)
+        except (TypeError, ValueError):
+            self._sorted_keys_cache = None
+            self._dirty = True
+
+    def __delitem__(self, key: K) -> None:
+        super().__delitem__(key)
+        self._forget_key(key)
+
+    def pop(self, key: K, *default):
+        if key in self:
+            value = dict.__getitem__(self, key)
+            del self[key]
+            return value
+        if default:
+            return default[0]
+        raise KeyError(key)
+
+    def popitem(self) -> Tuple[K, V]:
+        key, value = super().popitem()
+        self._forget_key(key)
+        return key, value
+
+    def clear(self) -> None:
+        super().clear()
+        self._entry_cache.clear()
         self._sorted_keys_cache = None
+        self._dirty = True
+
+    def setdefault(self, key: K, default: V = None) -> V:
+        if key not in self:
+            self[key] = default
+        return dict.__getitem__(self, key)
 
     def __repr__(self) -> str:
         """Get string representation."""
         items = [f"{k!r}: {v!r}" for k, v in self.items()]
         return f"Dictionary({{{', '.join(items)}}})"
-    
+
     def update(self, other: Mapping[K, V]) -> None:
         for key, value in other.items():
             self._validate(key, value)
         super().update(other)
+        for key in other:
+            self._entry_cache.pop(key, None)
         self._dirty = True
         self._sorted_keys_cache = None
 
@@ -127,15 +212,55 @@ class Dictionary(dict, Codable, Generic[K, V], metaclass=DictCheckMeta):
     #                                  Serialization                               #
     # ---------------------------------------------------------------------------- #
 
+    @classmethod
+    def _values_cacheable(cls) -> bool:
+        """Whether entry bytes may be cached across encodes.
+
+        Only value types whose instances cannot change after construction
+        qualify; anything else (structures, sequences, nested dictionaries)
+        can be mutated in place behind the cache's back.
+        """
+        cacheable = cls.__dict__.get("_cache_entries")
+        if cacheable is None:
+            from tsrkit_types.bool import Bool
+            from tsrkit_types.bytes import Bytes
+            from tsrkit_types.integers import Int
+            from tsrkit_types.string import String
+
+            value_type = getattr(cls, "_value_type", None)
+            cacheable = isinstance(value_type, type) and issubclass(
+                value_type, (Int, String, Bytes, Bool)
+            )
+            cls._cache_entries = cacheable
+        return cacheable
+
+    def _encode_entry(self, key: K) -> bytes:
+        """Encoded key + value bytes, re-encoded only for inserted/modified entries."""
+        cacheable = self._values_cacheable()
+        if cacheable:
+            enc = self._entry_cache.get(key)
+            if enc is not None:
+                return enc
+        value = dict.__getitem__(self, key)
+        writer = _acquire_writer()
+        try:
+            key.encode_to(writer)
+            value.encode_to(writer)
+            enc = writer.getvalue()
+        finally:
+            _release_writer(writer)
+        if cacheable:
+            self._entry_cache[key] = enc
+        return enc
+
     def encode_size(self) -> int:
-        total_size = 0
-        total_size += Uint(len(self)).encode_size()
-        for k, v in self.items():
-            total_size += k.encode_size() + v.encode_size()
+        total_size = Uint(len(self)).encode_size()
+        for k in self:
+            total_size += len(self._encode_entry(k))
         return total_size
-    
-    def _get_sorted_items(self):
-        """Get items in sorted order, with caching."""
+
+    def _get_sorted_keys(self) -> list:
+        """Keys in sorted order; rebuilt only when incremental upkeep bailed out."""
         if self._dirty or self._sorted_keys_cache is None:
             # Sort keys - check if keys have natural ordering
             try:
@@ -147,14 +272,25 @@ class Dictionary(dict, Codable, Generic[K, V], metaclass=DictCheckMeta):
                 self._sorted_keys_cache = [k for k, _ in sorted(key_encoded, key=lambda x: x[1])]
             self._dirty = False
 
-        return [(k, self[k]) for k in self._sorted_keys_cache]
+        return self._sorted_keys_cache
+
+    def _get_sorted_items(self):
+        """Get items in sorted order, with caching."""
+        return [(k, self[k]) for k in self._get_sorted_keys()]
+
+    def encode_to(self, writer) -> None:
+        # Single pass: no up-front encode_size() traversal
+        Uint(len(self)).encode_to(writer)
+        for k in self._get_sorted_keys():
+            writer.write(self._encode_entry(k))
 
     def encode_into(self, buffer: bytearray, offset: int = 0) -> int:
         current_offset = offset
         current_offset += Uint(len(self)).encode_into(buffer, current_offset)
-        for k, v in self._get_sorted_items():
-            current_offset += k.encode_into(buffer, current_offset)
-            current_offset += v.encode_into(buffer, current_offset)
+        for k in self._get_sorted_keys():
+            enc = self._encode_entry(k)
+            buffer[current_offset:current_offset + len(enc)] = enc
+            current_offset += len(enc)
         return current_offset - offset
 
     @classmethod
@@ -172,6 +308,17 @@ class Dictionary(dict, Codable, Generic[K, V], metaclass=DictCheckMeta):
             )
 
         res = cls()
+
+        if trusted_enabled():
+            # Skip key-ordering and type validation on pre-verified input
+            for _ in range(dict_len):
+                key, size = cls._key_type.decode_from(buffer, current_offset)
+                current_offset += size
+                value, size = cls._value_type.decode_from(buffer, current_offset)
+                current_offset += size
+                dict.__setitem__(res, key, value)
+            return res, current_offset - offset
+
         prev_key = None
 
         for _ in range(dict_len):
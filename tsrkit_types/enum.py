@@ -5,7 +5,30 @@ from tsrkit_types.integers import Uint
 T = TypeVar("T", bound="Enum")
 
 
-class Enum(metaclass=EnumMeta):
+class CodableEnumMeta(EnumMeta):
+    """
+    EnumMeta that precomputes codec tables when members are defined.
+
+    Members are immutable and discriminators never change, so each member's
+    encoded bytes are cached at class creation (encode_into becomes a buffer
+    copy) and an index -> member table makes decode_from a single list index.
+    """
+
+    def __new__(mcls, name, bases, namespace, **kwargs):
+        cls = super().__new__(mcls, name, bases, namespace, **kwargs)
+        members = [cls._member_map_[n] for n in cls._member_names_]
+        if members and len(members) <= 256:
+            for i, member in enumerate(members):
+                member._codec_index_ = i
+            cls._member_table_ = tuple(members)
+            cls._encoded_table_ = tuple(Uint(i).encode() for i in range(len(members)))
+        else:
+            cls._member_table_ = None
+            cls._encoded_table_ = None
+        return cls
+
+
+class Enum(metaclass=CodableEnumMeta):
     """Decodable Enum type - Extending the built-in Enum type to add encoding and decoding methods
 
     How to use it:
@@ -47,6 +70,11 @@ class Enum(metaclass=EnumMeta):
         written = self.encode_into(buffer)
         return bytes(buffer[:written])
 
+    def encode_to(self, writer) -> None:
+        """Encode this enum value into a growable writer (single-pass path)."""
+        writer.reserve(self.encode_size())
+        writer.pos += self.encode_into(writer.buf, writer.pos)
+
     def encode_into(self, buffer: bytearray, offset: int = 0) -> int:
         """Encode this enum value into the given buffer at the given offset
 
@@ -60,6 +88,13 @@ class Enum(metaclass=EnumMeta):
         Raises:
             ValueError: If the enum has too many variants to encode in a byte
         """
+        # Fast path: copy the member's cached encoding (built at class creation)
+        encoded = self.__class__._encoded_table_
+        if encoded is not None:
+            enc = encoded[self._codec_index_]
+            buffer[offset:offset + len(enc)] = enc
+            return len(enc)
+
         # Get the index of the enum value in all enums
         # Encode the index as a byte
         all_enums = self.__class__._member_names_
@@ -84,6 +119,11 @@ class Enum(metaclass=EnumMeta):
         Raises:
             ValueError: If the encoded index is invalid
         """
+        # Fast path: single-byte discriminator straight into the member table
+        table = cls._member_table_
+        if table is not None and len(buffer) > offset and buffer[offset] < 128:
+            return cast(T, table[buffer[offset]]), 1
+
         # Decode the byte (index of enum) into an Enum
         # Return the enum value
         index, bytes_read = Uint.decode_from(buffer, offset)
@@ -13,12 +13,73 @@ except ImportError:
     else:
         Self = "Uint"  # Forward reference string
 
-from tsrkit_types.itf.codable import Codable
+from tsrkit_types.itf.codable import Codable, _decode_flags
+
+try:
+    # Optional compiled backend for the general-Uint varint codec
+    # (built via `make build` / setup.py build_ext). Falls back to the
+    # pure-Python implementation below when unavailable.
+    from tsrkit_types import _native
+except ImportError:
+    _native = None
+
+
+# Interned parameterized classes: Uint[32] always returns the same class
+# object, so isinstance checks are identity-fast and repeated inline
+# annotations don't mint duplicate classes.
+_param_cache = {}
+
+# Fixed byte sizes with a struct format char, used by the batch codec paths
+_FIXED_FMT_CHAR = {1: "B", 2: "H", 4: "I", 8: "Q"}
+
+# Values below this bound are served from a per-class cache of
+# preconstructed instances (like CPython's small-int cache). Int
+# subclasses are immutable, so sharing decoded instances is safe.
+_SMALL_CACHE_SIZE = 256
+
+
+def _build_varint_tag_table():
+    """(trailing_len, alpha) for every possible varint tag byte.
+
+    Tags below 128 encode the value inline (trailing_len 0, alpha is the
+    value itself); 255 marks a full 64-bit little-endian payload; the rest
+    carry the high bits (alpha) in the tag with trailing_len payload bytes.
+    """
+    table = []
+    for tag in range(256):
+        if tag < 128:
+            table.append((0, tag))
+        elif tag == 255:
+            table.append((8, 0))
+        else:
+            x = 256 - tag
+            if (x & (x - 1)) == 0:  # x is a power of 2
+                _l = 9 - x.bit_length()
+            else:
+                _l = 8 - x.bit_length()
+            table.append((_l, tag + (1 << (8 - _l)) - 256))
+    return tuple(table)
+
+
+# Decode side: one lookup per tag byte replaces the bit_length/power-of-two
+# arithmetic in the hot varint path.
+_VARINT_TAG_TABLE = _build_varint_tag_table()
+
+# Encode side: trailing length by value bit_length (varint `l` depends only
+# on bit_length), plus per-l prefix bases and beta masks.
+_VARINT_BITLEN_TO_L = tuple(
+    8 if bl > 56 else (bl - 1) // 7 if bl > 0 else 0 for bl in range(65)
+)
+_VARINT_PREFIX_BASE = tuple(256 - (1 << (8 - _l)) if 0 < _l < 8 else 0 for _l in range(9))
+_VARINT_BETA_MASK = tuple((1 << (8 * _l)) - 1 for _l in range(9))
 
 
 class IntCheckMeta(abc.ABCMeta):
     """Meta class to check if the instance is an integer with the same byte size"""
     def __instancecheck__(cls, instance):
+        # Fast path: parameterized classes are interned, so exact matches are common
+        if type(instance) is cls:
+            return True
         return isinstance(instance, int) and getattr(instance, "byte_size", 0) == cls.byte_size
 
 
@@ -89,16 +150,43 @@ class Int(int, Codable, metaclass=IntCheckMeta):
             else: 
                 size, signed = 0, bool(data)
         else:
-            size, signed = data 
+            size, signed = data
+
+        cache_key = (cls, size, signed)
+        cached = _param_cache.get(cache_key)
+        if cached is not None:
+            return cached
 
-        return type(f"U{size}" if size else "Int", (cls,), {
-            "byte_size": size // 8, 
-            "signed": signed, 
+        new_cls = type(f"U{size}" if size else "Int", (cls,), {
+            "byte_size": size // 8,
+            "signed": signed,
             "_bound": 1 << size if size > 0 else 1 << 64
         })
+        _param_cache[cache_key] = new_cls
+        return new_cls
+
+    @classmethod
+    def _small_values(cls) -> tuple:
+        """Per-class tuple of preconstructed instances for small values, built lazily."""
+        cache = cls.__dict__.get("_small_value_cache")
+        if cache is None:
+            if cls.signed:
+                cache = ()
+            else:
+                limit = min(_SMALL_CACHE_SIZE, cls._bound)
+                # int.__new__ directly: values are in range by construction
+                cache = tuple(int.__new__(cls, v) for v in range(limit))
+            cls._small_value_cache = cache
+        return cache
 
     def __new__(cls, value: Any):
         value = int(value)
+        if 0 <= value < _SMALL_CACHE_SIZE and not cls.signed:
+            cache = cls.__dict__.get("_small_value_cache")
+            if cache is None:
+                cache = cls._small_values()
+            if value < len(cache):
+                return cache[value]
         if cls.byte_size > 0:
             max_v = (cls._bound // 2 if cls.signed else cls._bound) - 1  
             min_v = -1 * cls._bound // 2 if cls.signed else 0
@@ -173,16 +261,14 @@ class Int(int, Codable, metaclass=IntCheckMeta):
             return self.byte_size
         else:
             value = self.to_unsigned()
+            if _native is not None:
+                return _native.uint_encode_size(value)
             if value < 128:  # 2**7
                 return 1
-            elif value < 2 ** 56:  # 2 ** (7 * 8)
-                # Calculate length using bit operations
-                _l = (value.bit_length() - 1) // 7
-                return 1 + _l
-            elif value < 2**64:
-                return 9
-            else:
+            bl = value.bit_length()
+            if bl > 64:
                 raise ValueError("Value too large for encoding. General Int support up to 2**64 - 1")
+            return 1 + _VARINT_BITLEN_TO_L[bl]
 
     def encode_into(self, buffer: bytearray, offset: int = 0) -> int:
         if self.byte_size > 0:
@@ -196,35 +282,33 @@ class Int(int, Codable, metaclass=IntCheckMeta):
         else:
             value = int(self)
 
+            if _native is not None:
+                return _native.uint_encode_into(value, buffer, offset)
+
             # Fast path: single byte
             if value < 128:  # 2^7
                 buffer[offset] = value
                 return 1
 
-            size = self.encode_size()
+            bl = value.bit_length()
+            if bl > 64:
+                raise ValueError(
+                    f"Value too large for encoding. General Uint support up to 2**64 - 1, got {value}"
+                )
+            _l = _VARINT_BITLEN_TO_L[bl]
+            size = 1 + _l
             self._check_buffer_size(buffer, size, offset)
 
-            if value < 2 ** 56:  # 2^(7*8)
-                _l = (value.bit_length() - 1) // 7
-
-                # Calculate prefix using bit shifts instead of Decimal division
-                alpha = value >> (_l * 8)
-                prefix = (256 - (1 << (8 - _l))) + alpha
-                buffer[offset] = prefix
+            if _l < 8:
+                # Tag carries the high bits; _l little-endian payload bytes follow
+                buffer[offset] = _VARINT_PREFIX_BASE[_l] + (value >> (_l * 8))
                 offset += 1
-
-                # Encode the remaining bytes using mask
-                beta = value & ((1 << (_l * 8)) - 1)
-                remaining_bytes = beta.to_bytes(_l, "little")
-                buffer[offset : offset + _l] = remaining_bytes
-            elif value < 2**64:
+                beta = value & _VARINT_BETA_MASK[_l]
+                buffer[offset : offset + _l] = beta.to_bytes(_l, "little")
+            else:
                 buffer[offset] = 255  # 2**8 - 1, Full 64-bit marker
                 offset += 1
                 buffer[offset : offset + 8] = value.to_bytes(8, "little")
-            else:
-                raise ValueError(
-                    f"Value too large for encoding. General Uint support up to 2**64 - 1, got {value}"
-                )
             return size
     
     @classmethod
@@ -242,38 +326,74 @@ class Int(int, Codable, metaclass=IntCheckMeta):
                 value = s.unpack_from(buffer, offset)[0]
             else:
                 value = int.from_bytes(buffer[offset : offset + cls.byte_size], "little")
+            if value < _SMALL_CACHE_SIZE and not cls.signed:
+                # Shared preconstructed instance - no allocation at all
+                cache = cls.__dict__.get("_small_value_cache") or cls._small_values()
+                if value < len(cache):
+                    return cache[value], cls.byte_size
+            if getattr(_decode_flags, "trusted", False):
+                return int.__new__(cls, value), cls.byte_size
             return cls.__new__(cls, value), cls.byte_size
         else:
+            if _native is not None:
+                value, size = _native.uint_decode_from(buffer, offset)
+                if getattr(_decode_flags, "trusted", False):
+                    return int.__new__(cls, value), size
+                return cls(value), size
+
             tag = int.from_bytes(buffer[offset:offset+1], "little")
 
-            if tag < 128:  # 2^7
-                return cls(tag), 1
+            # One table lookup replaces the per-call bit_length/power-of-two math
+            _l, alpha = _VARINT_TAG_TABLE[tag]
 
-            if tag == 255:  # 2**8 - 1
-                # Full 64-bit encoding
-                if len(buffer) - offset < 9:
+            if _l == 0:  # tag < 128: value encoded inline
+                return cls(alpha), 1
+
+            if len(buffer) - offset < _l + 1:
+                if _l == 8:
                     raise ValueError("Buffer too small to decode 64-bit integer")
-                value = int.from_bytes(buffer[offset + 1 : offset + 9], "little")
-                return cls(value), 9
-            else:
-                # Variable length encoding - use bit operations
-                # Calculate _l from tag: _l = floor(8 - log2(256 - tag))
-                # bit_length() = floor(log2(x)) + 1, but floor doesn't distribute over subtraction
-                # Special case: if (256-tag) is a power of 2, use 9-bit_length; otherwise 8-bit_length
-                x = 256 - tag
-                if x > 0 and (x & (x - 1)) == 0:  # x is a power of 2
-                    _l = 9 - x.bit_length()
-                else:
-                    _l = 8 - x.bit_length()
-
-                if len(buffer) - offset < _l + 1:
-                    raise ValueError("Buffer too small to decode variable-length integer")
-
-                alpha = tag + (1 << (8 - _l)) - 256
-                beta = int.from_bytes(buffer[offset + 1 : offset + 1 + _l], "little")
-                value = (alpha << (_l * 8)) + beta
-                return cls(value), _l + 1
+                raise ValueError("Buffer too small to decode variable-length integer")
+
+            beta = int.from_bytes(buffer[offset + 1 : offset + 1 + _l], "little")
+            value = (alpha << (_l * 8)) + beta
+            return cls(value), _l + 1
             
+    @classmethod
+    def encode_batch(cls, values, buffer: bytearray = None, offset: int = 0) -> Union[bytes, int]:
+        """Bulk-pack a run of fixed-size unsigned ints with one struct call."""
+        fmt = None if cls.signed else _FIXED_FMT_CHAR.get(cls.byte_size)
+        if fmt is None:
+            return super().encode_batch(values, buffer, offset)
+        values = list(values)
+        total = len(values) * cls.byte_size
+        if buffer is None:
+            buffer = bytearray(total)
+            struct.pack_into(f"<{len(values)}{fmt}", buffer, 0, *values)
+            return bytes(buffer)
+        struct.pack_into(f"<{len(values)}{fmt}", buffer, offset, *values)
+        return total
+
+    @classmethod
+    def decode_batch(
+        cls, buffer: Union[bytes, bytearray, memoryview], count: int, offset: int = 0
+    ) -> Tuple[list, int]:
+        """Bulk-unpack a run of fixed-size unsigned ints with one struct call."""
+        fmt = None if cls.signed else _FIXED_FMT_CHAR.get(cls.byte_size)
+        if fmt is None:
+            return super().decode_batch(buffer, count, offset)
+        raw = struct.unpack_from(f"<{count}{fmt}", buffer, offset)
+        # Unpacked values are exactly in range for the type - skip __new__ checks
+        new = int.__new__
+        return [new(cls, v) for v in raw], count * cls.byte_size
+
+    @classmethod
+    def decode_size_from(cls, buffer: Union[bytes, bytearray, memoryview], offset: int = 0) -> int:
+        """Skip length of the encoding at `offset` without materializing the value."""
+        if cls.byte_size > 0:
+            return cls.byte_size
+        tag = buffer[offset] if len(buffer) > offset else 0
+        return 1 + _VARINT_TAG_TABLE[tag][0]
+
     def to_bits(self, bit_order: str = "msb") -> list[bool]:
         """Convert an int to bits"""
         if bit_order == "msb":
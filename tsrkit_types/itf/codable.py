@@ -1,12 +1,207 @@
+import threading
+import time
 from abc import ABC, abstractmethod
+from contextlib import contextmanager
 from typing import TypeVar, Generic, Tuple, Union
 
 T = TypeVar("T")
 
+# Per-thread decode mode flags, consulted by type-specific decode_from
+# implementations (e.g. Bytes returns buffer-backed views under zero-copy).
+_decode_flags = threading.local()
+
+
+def zero_copy_enabled() -> bool:
+    """Whether the current thread is decoding in zero-copy mode."""
+    return getattr(_decode_flags, "zero_copy", False)
+
+
+@contextmanager
+def zero_copy_decode():
+    """
+    Context manager enabling zero-copy decoding on the current thread.
+
+    While active, types that support it (notably Bytes) decode to
+    memoryview-backed objects referencing the input buffer instead of
+    copying payloads out. Containers and structures inherit the mode
+    automatically since their fields decode through the same thread.
+    The input buffer must outlive (or be frozen out of) the decoded values.
+    """
+    prev = getattr(_decode_flags, "zero_copy", False)
+    _decode_flags.zero_copy = True
+    try:
+        yield
+    finally:
+        _decode_flags.zero_copy = prev
+
+
+def trusted_enabled() -> bool:
+    """Whether the current thread is decoding in trusted mode."""
+    return getattr(_decode_flags, "trusted", False)
+
+
+@contextmanager
+def trusted_decode():
+    """
+    Context manager enabling trusted decoding on the current thread.
+
+    While active, decode paths skip per-value validation: integers are
+    constructed without range checks, sequences without per-element
+    isinstance checks, and dictionaries without key-ordering verification.
+    Only use on input that has already been verified (e.g. replaying
+    hash-checked data from your own database) — malformed buffers can
+    produce out-of-contract values instead of raising.
+    """
+    prev = getattr(_decode_flags, "trusted", False)
+    _decode_flags.trusted = True
+    try:
+        yield
+    finally:
+        _decode_flags.trusted = prev
+
+
+class BufWriter:
+    """
+    Growable output buffer for single-pass encoding.
+
+    Capacity grows by amortized doubling, so one traversal of a value tree
+    can produce the encoded output without a separate encode_size() walk.
+    `reserve()` accepts size hints to pre-grow the buffer.
+    """
+
+    __slots__ = ("buf", "pos")
+
+    def __init__(self, initial_capacity: int = 128):
+        self.buf = bytearray(initial_capacity)
+        self.pos = 0
+
+    def reserve(self, n: int) -> None:
+        """Ensure at least `n` more bytes fit without another resize."""
+        need = self.pos + n
+        cap = len(self.buf)
+        if need > cap:
+            self.buf.extend(bytearray(max(cap * 2, need) - cap))
+
+    def write(self, data: Union[bytes, bytearray, memoryview]) -> int:
+        """Append raw bytes; returns the number of bytes written."""
+        n = len(data)
+        self.reserve(n)
+        self.buf[self.pos:self.pos + n] = data
+        self.pos += n
+        return n
+
+    def getvalue(self) -> bytes:
+        """The bytes written so far."""
+        return bytes(self.buf[:self.pos])
+
+    def __len__(self) -> int:
+        return self.pos
+
+
+# Per-thread pool of reusable BufWriters. Encoding is allocation-heavy at
+# high message rates, so encode() and encode_pooled() recycle writers here
+# instead of allocating a fresh buffer per call.
+_writer_pool = threading.local()
+
+# Keep at most this many writers per thread, and never pool one whose
+# buffer grew past this size — a single huge message should not pin memory.
+_POOL_MAX_WRITERS = 8
+_POOL_MAX_CAPACITY = 1 << 20
+
+
+def _acquire_writer() -> BufWriter:
+    """Take a writer from the current thread's pool, or allocate one."""
+    pool = getattr(_writer_pool, "writers", None)
+    if pool:
+        writer = pool.pop()
+        writer.pos = 0
+        return writer
+    return BufWriter()
+
+
+def _release_writer(writer: BufWriter) -> None:
+    """Return a writer to the current thread's pool for reuse."""
+    pool = getattr(_writer_pool, "writers", None)
+    if pool is None:
+        pool = _writer_pool.writers = []
+    if len(pool) < _POOL_MAX_WRITERS and len(writer.buf) <= _POOL_MAX_CAPACITY:
+        pool.append(writer)
+
+
+# Installed CodecCollector, or None. Checked only at the top-level
+# encode()/decode() entry points, so the disabled cost is one global load.
+_collector = None
+
+
+class CodecCollector:
+    """
+    Per-type codec counters: calls, bytes and cumulative seconds for
+    encode and decode.
+
+    Install with `install_collector()`; scrape `snapshot()` periodically
+    (the shape maps 1:1 onto Prometheus counters). Nested fields are not
+    double-counted — a container records its whole subtree under the
+    container's type, since inner values encode through encode_to, not
+    encode().
+    """
+
+    __slots__ = ("_lock", "_stats")
+
+    def __init__(self):
+        self._lock = threading.Lock()
+        self._stats = {}
+
+    def record(self, type_name: str, op: str, nbytes: int, seconds: float) -> None:
+        key = (type_name, op)
+        with self._lock:
+            entry = self._stats.get(key)
+            if entry is None:
+                entry = self._stats[key] = [0, 0, 0.0]
+            entry[0] += 1
+            entry[1] += nbytes
+            entry[2] += seconds
+
+    def snapshot(self) -> dict:
+        """{type_name: {op: {"calls", "bytes", "seconds"}}} at this instant."""
+        with self._lock:
+            result = {}
+            for (type_name, op), (calls, nbytes, seconds) in self._stats.items():
+                result.setdefault(type_name, {})[op] = {
+                    "calls": calls,
+                    "bytes": nbytes,
+                    "seconds": seconds,
+                }
+            return result
+
+    def reset(self) -> None:
+        with self._lock:
+            self._stats.clear()
+
+
+def install_collector(collector: CodecCollector = None) -> CodecCollector:
+    """Activate instrumentation; returns the (new or given) collector."""
+    global _collector
+    if collector is None:
+        collector = CodecCollector()
+    _collector = collector
+    return collector
+
+
+def uninstall_collector() -> CodecCollector:
+    """Deactivate instrumentation; returns the collector that was active."""
+    global _collector
+    collector, _collector = _collector, None
+    return collector
+
 
 class Codable(ABC, Generic[T]):
     """Abstract base class defining the interface for encoding and decoding data."""
 
+    # Empty so slots-based subclasses (e.g. @structure(slots=True)) do not
+    # pick up an instance __dict__ through this mixin. Subclasses without
+    # their own __slots__ still get a __dict__ as usual.
+    __slots__ = ()
+
     @abstractmethod
     def encode_size(self) -> int:
         """
@@ -31,6 +226,22 @@ class Codable(ABC, Generic[T]):
         """
         raise NotImplementedError("Subclasses must implement this method")
 
+    def encode_to(self, writer: BufWriter) -> None:
+        """
+        Encode the value into a growable writer in a single traversal.
+
+        The default implementation sizes and writes this value in place;
+        container types override it to recurse into their elements so deep
+        trees are walked once instead of the encode_size/encode_into
+        double walk.
+
+        Args:
+            writer: The BufWriter to append the encoding to.
+        """
+        size = self.encode_size()
+        writer.reserve(size)
+        writer.pos += self.encode_into(writer.buf, writer.pos)
+
     def encode(self) -> bytes:
         """
         Encode the value into a new bytes object.
@@ -38,10 +249,48 @@ class Codable(ABC, Generic[T]):
         Returns:
             The encoded value as a bytes object.
         """
-        size = self.encode_size()
-        buffer = bytearray(size)
-        written = self.encode_into(buffer)
-        return bytes(buffer[:written])
+        collector = _collector
+        if collector is not None:
+            start = time.perf_counter()
+            writer = _acquire_writer()
+            try:
+                self.encode_to(writer)
+                data = writer.getvalue()
+            finally:
+                _release_writer(writer)
+            collector.record(
+                type(self).__name__, "encode", len(data), time.perf_counter() - start
+            )
+            return data
+        writer = _acquire_writer()
+        try:
+            self.encode_to(writer)
+            return writer.getvalue()
+        finally:
+            _release_writer(writer)
+
+    @contextmanager
+    def encode_pooled(self):
+        """
+        Encode into a pooled buffer and yield a memoryview of the encoding.
+
+        Avoids the bytes copy that `encode()` pays: the view references the
+        pooled buffer directly, so it is only valid inside the `with` block —
+        copy it (`bytes(view)`) if it must outlive the scope.
+
+        >>> with value.encode_pooled() as view:
+        ...     socket.sendall(view)
+        """
+        writer = _acquire_writer()
+        view = None
+        try:
+            self.encode_to(writer)
+            view = memoryview(writer.buf)[:writer.pos]
+            yield view
+        finally:
+            if view is not None:
+                view.release()
+            _release_writer(writer)
 
     @classmethod
     def decode_from(cls, buffer: Union[bytes, bytearray, memoryview], offset: int = 0) -> Tuple[T, int]:
@@ -58,17 +307,94 @@ class Codable(ABC, Generic[T]):
         raise NotImplementedError("Subclasses must implement this method")
 
     @classmethod
-    def decode(cls, buffer: Union[bytes, bytearray, memoryview], offset: int = 0) -> T:
+    def decode(cls, buffer: Union[bytes, bytearray, memoryview], offset: int = 0, trusted: bool = False) -> T:
         """
         Decode a value from the provided buffer starting at the specified offset.
 
         Args:
             buffer: The buffer to decode the value from.
             offset: The offset at which to start decoding the value.
+            trusted: Skip per-value validation (see `trusted_decode`). Only
+                use on input that has already been verified elsewhere.
         """
-        value, bytes_read = cls.decode_from(buffer, offset)
+        collector = _collector
+        start = time.perf_counter() if collector is not None else 0.0
+        if trusted:
+            with trusted_decode():
+                value, bytes_read = cls.decode_from(buffer, offset)
+        else:
+            value, bytes_read = cls.decode_from(buffer, offset)
+        if collector is not None:
+            collector.record(
+                cls.__name__, "decode", bytes_read, time.perf_counter() - start
+            )
         return value
     
+    @classmethod
+    def encode_batch(cls, values, buffer: bytearray = None, offset: int = 0) -> Union[bytes, int]:
+        """
+        Encode a homogeneous run of values back to back.
+
+        With no buffer, returns the concatenated encoding as bytes (via a
+        pooled writer). With a buffer, encodes in place starting at `offset`
+        and returns the number of bytes written. The loop binds methods once,
+        so long runs avoid repeated attribute dispatch; fixed-size types
+        override this with bulk struct packing.
+        """
+        if buffer is None:
+            writer = _acquire_writer()
+            try:
+                for value in values:
+                    value.encode_to(writer)
+                return writer.getvalue()
+            finally:
+                _release_writer(writer)
+        current_offset = offset
+        for value in values:
+            current_offset += value.encode_into(buffer, current_offset)
+        return current_offset - offset
+
+    @classmethod
+    def decode_batch(
+        cls, buffer: Union[bytes, bytearray, memoryview], count: int, offset: int = 0
+    ) -> Tuple[list, int]:
+        """
+        Decode `count` consecutive values of this type.
+
+        Returns (values, bytes_read). The default implementation hoists the
+        decode method and list append out of the loop; fixed-size types
+        override it with bulk struct unpacking.
+        """
+        decode_from = cls.decode_from
+        values = []
+        append = values.append
+        current_offset = offset
+        for _ in range(count):
+            value, size = decode_from(buffer, current_offset)
+            current_offset += size
+            append(value)
+        return values, current_offset - offset
+
+    @classmethod
+    def decode_size_from(cls, buffer: Union[bytes, bytearray, memoryview], offset: int = 0) -> int:
+        """
+        Number of bytes the encoding at `offset` occupies, without keeping
+        the decoded value.
+
+        The default implementation decodes and discards; fixed-size and
+        length-prefixed types override it to skip without materializing,
+        which is what makes lazy field decoding cheap.
+
+        Args:
+            buffer: The buffer containing the encoded value.
+            offset: The offset at which the encoding starts.
+
+        Returns:
+            The number of bytes the encoded value occupies.
+        """
+        _, size = cls.decode_from(buffer, offset)
+        return size
+
     @classmethod
     def _check_buffer_size(cls, buffer: bytearray, size: int, offset: int) -> None:
         """
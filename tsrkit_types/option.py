@@ -5,6 +5,10 @@ from tsrkit_types.null import Null, NullType
 
 T = TypeVar("T")
 
+# Interned parameterized classes: Option[T] always returns the same class
+_param_cache = {}
+
+
 class Option(Choice, Generic[T]):
     """
     Option[T] wraps either no value (None) or a T.
@@ -14,9 +18,17 @@ class Option(Choice, Generic[T]):
         if not isinstance(opt_t, type):
             raise TypeError("Option[...] only accepts a single type")
         name = f"Option[{opt_t.__class__.__name__}]"
-        return type(name,
-                    (Option,),
-                    {"_opt_types": ((None, NullType), (None, opt_t))})
+
+        cache_key = (cls, opt_t)
+        cached = _param_cache.get(cache_key)
+        if cached is not None:
+            return cached
+
+        new_cls = type(name,
+                       (Option,),
+                       {"_opt_types": ((None, NullType), (None, opt_t))})
+        _param_cache[cache_key] = new_cls
+        return new_cls
 
     def __init__(self, val: T|NullType = Null, key = None):
         super().__init__(val)
@@ -1,13 +1,61 @@
 import abc
-from typing import TypeVar, Type, ClassVar, Tuple, Generic, Optional
+import struct
+import sys
+from array import array
+from typing import TypeVar, Type, ClassVar, Tuple, Generic, Optional, Union
 from tsrkit_types.integers import Uint
-from tsrkit_types.itf.codable import Codable
+from tsrkit_types.itf.codable import (
+    Codable,
+    trusted_enabled,
+    zero_copy_enabled,
+    _decode_flags,
+    _acquire_writer,
+    _release_writer,
+)
 
 T = TypeVar("T")
 
+# struct format characters for fixed-size unsigned integer element types,
+# keyed by byte_size. Runs of such elements encode/decode with one bulk
+# pack/unpack instead of a per-element Python call.
+_FIXED_INT_FMT = {1: "B", 2: "H", 4: "I", 8: "Q"}
+
+
+def _raw_typecode(byte_size: int) -> Optional[str]:
+    """array typecode whose item size matches `byte_size` on this platform.
+
+    Typecode widths are C-type widths, so 4 bytes is 'I' on mainstream
+    platforms but 'L' where unsigned int is wider; probe itemsize instead
+    of hardcoding.
+    """
+    for typecode in ("B", "H", "I", "L", "Q"):
+        if array(typecode).itemsize == byte_size:
+            return typecode
+    return None
+
+
+def _bulk_int_format(elem_t) -> Optional[str]:
+    """Format char for bulk packing, or None if the element type doesn't qualify."""
+    if (
+        isinstance(elem_t, type)
+        and issubclass(elem_t, Uint)
+        and not getattr(elem_t, "signed", False)
+    ):
+        return _FIXED_INT_FMT.get(getattr(elem_t, "byte_size", 0))
+    return None
+
+# Interned parameterized classes: Seq[T, N] with the same params always
+# returns the same class object (see __class_getitem__)
+_param_cache = {}
+
+
 class SeqCheckMeta(abc.ABCMeta):
     """Meta class to check if the instance is an integer with the same byte size"""
     def __instancecheck__(cls, instance):
+        # Fast path: parameterized classes are interned, so exact/subclass
+        # matches resolve by identity without attribute comparisons
+        if type(instance) is cls or issubclass(type(instance), cls):
+            return True
         # String comparison is used to avoid identity comparison issues - like Uint[8] and Uint[8]
         # TODO - This needs more false positive testing
         _matches_element_type = str(getattr(cls, "_element_type", None)) == str(getattr(instance, "_element_type", None))
@@ -33,6 +81,8 @@ class Seq(list, Codable, Generic[T], metaclass=SeqCheckMeta):
     _element_type: ClassVar[Type[T]]
     _min_length: ClassVar[int] = 0
     _max_length: ClassVar[int] = 2 ** 64
+    # Set when _element_type is a fixed-size unsigned integer (see _bulk_int_format)
+    _bulk_fmt: ClassVar[Optional[str]] = None
 
     def __class_getitem__(cls, params):
         # To overwrite previous cls values
@@ -71,11 +121,23 @@ class Seq(list, Codable, Generic[T], metaclass=SeqCheckMeta):
 
         name = f"{cls.__name__}[{','.join(parts)}]"
 
-        return type(name, (cls,), {
+        cache_key = (cls, elem_t, min_l, max_l)
+        try:
+            cached = _param_cache.get(cache_key)
+        except TypeError:
+            cached, cache_key = None, None  # unhashable param (e.g. TypeVar tuples)
+        if cached is not None:
+            return cached
+
+        new_cls = type(name, (cls,), {
             "_element_type": elem_t,
             "_min_length": min_l,
             "_max_length": max_l,
+            "_bulk_fmt": _bulk_int_format(elem_t),
         })
+        if cache_key is not None:
+            _param_cache[cache_key] = new_cls
+        return new_cls
 
     def _validate(self, value):
         """For TypeChecks - added to fns that alter elements"""
@@ -132,7 +194,11 @@ class Seq(list, Codable, Generic[T], metaclass=SeqCheckMeta):
         # If length is not defined
         if self._length is None:
             size += Uint(len(self)).encode_size()
-            
+
+        # Fast path: fixed-size integer elements have a constant size
+        if self._bulk_fmt is not None:
+            return size + len(self) * self._element_type.byte_size
+
         for item in self:
             if not isinstance(item, Codable):
                 raise TypeError(0, 0, f"Expected Codable, got {type(item)}")
@@ -140,12 +206,30 @@ class Seq(list, Codable, Generic[T], metaclass=SeqCheckMeta):
 
         return size
     
+    def encode_to(self, writer) -> None:
+        # Single pass: no up-front encode_size() traversal
+        if self._min_length != self._max_length:
+            Uint(len(self)).encode_to(writer)
+        if self._bulk_fmt is not None and len(self) > 0:
+            n = len(self) * self._element_type.byte_size
+            writer.reserve(n)
+            struct.pack_into(f"<{len(self)}{self._bulk_fmt}", writer.buf, writer.pos, *self)
+            writer.pos += n
+            return
+        for item in self:
+            item.encode_to(writer)
+
     def encode_into(self, buffer: bytearray, offset: int = 0) -> int:
         current_offset = offset
         # If length is not defined
         if(self._min_length != self._max_length):
             current_offset += Uint(len(self)).encode_into(buffer, current_offset)
 
+        # Fast path: pack the whole run of fixed-size integers in one call
+        if self._bulk_fmt is not None and len(self) > 0:
+            struct.pack_into(f"<{len(self)}{self._bulk_fmt}", buffer, current_offset, *self)
+            return current_offset + len(self) * self._element_type.byte_size - offset
+
         for item in self:
             written = item.encode_into(buffer, current_offset)
             current_offset += written
@@ -173,14 +257,240 @@ class Seq(list, Codable, Generic[T], metaclass=SeqCheckMeta):
                     f"Sequence length {_len} exceeds maximum {MAX_SEQUENCE_LENGTH}"
                 )
 
-        items = []
-        for _ in range(_len):
-            item, _inc_offset = cls._element_type.decode_from(buffer, current_offset)
-            current_offset += _inc_offset
-            items.append(item)
+        trusted = trusted_enabled()
+
+        # Fast path: unpack the whole run of fixed-size integers in one call
+        if cls._bulk_fmt is not None and _len > 0:
+            n = int(_len)  # may be a decoded Int; struct formats want plain int
+            elem_t = cls._element_type
+            byte_size = elem_t.byte_size
+            try:
+                values = struct.unpack_from(f"<{n}{cls._bulk_fmt}", buffer, current_offset)
+            except struct.error:
+                raise ValueError(
+                    f"Buffer too small: need {n * byte_size} bytes at offset {current_offset}, "
+                    f"but buffer has only {len(buffer)} bytes"
+                )
+            if trusted:
+                items = [int.__new__(elem_t, v) for v in values]
+            else:
+                items = list(map(elem_t, values))
+            current_offset += n * byte_size
+        else:
+            items = []
+            for _ in range(_len):
+                item, _inc_offset = cls._element_type.decode_from(buffer, current_offset)
+                current_offset += _inc_offset
+                items.append(item)
+
+        if trusted:
+            # Construct without per-element isinstance/length validation
+            result = list.__new__(cls)
+            list.__init__(result, items)
+            return result, current_offset - offset
 
         return cls(items), current_offset - offset
 
+    @classmethod
+    def decode_batch(
+        cls, buffer: Union[bytes, bytearray, memoryview], count: int, offset: int = 0
+    ) -> Tuple[list, int]:
+        """
+        Decode `count` consecutive sequences of this type.
+
+        Fixed-length sequences of fixed-size integers share one compiled
+        struct across the run; the unpacked values are range-exact for the
+        element type so per-element validation is skipped.
+        """
+        if cls._bulk_fmt is not None and 0 < cls._min_length == cls._max_length:
+            n = cls._min_length
+            elem_t = cls._element_type
+            item_size = n * elem_t.byte_size
+            unpack_from = struct.Struct(f"<{n}{cls._bulk_fmt}").unpack_from
+            new_int = int.__new__
+            new_list = list.__new__
+            init_list = list.__init__
+            results = []
+            append = results.append
+            current_offset = offset
+            for _ in range(count):
+                values = unpack_from(buffer, current_offset)
+                seq = new_list(cls)
+                init_list(seq, [new_int(elem_t, v) for v in values])
+                append(seq)
+                current_offset += item_size
+            return results, current_offset - offset
+        return super().decode_batch(buffer, count, offset)
+
+    @classmethod
+    def encode_batch(cls, values, buffer: bytearray = None, offset: int = 0) -> Union[bytes, int]:
+        """Encode a run of sequences, sharing one compiled struct when fixed-size."""
+        if cls._bulk_fmt is not None and 0 < cls._min_length == cls._max_length:
+            n = cls._min_length
+            item_size = n * cls._element_type.byte_size
+            pack_into = struct.Struct(f"<{n}{cls._bulk_fmt}").pack_into
+            values = list(values)
+            out = bytearray(item_size * len(values)) if buffer is None else buffer
+            current_offset = 0 if buffer is None else offset
+            for seq in values:
+                pack_into(out, current_offset, *seq)
+                current_offset += item_size
+            if buffer is None:
+                return bytes(out)
+            return item_size * len(values)
+        return super().encode_batch(values, buffer, offset)
+
+    @classmethod
+    def decode_size_from(cls, buffer: bytes, offset: int = 0) -> int:
+        """Skip length of the encoding at `offset` without materializing elements."""
+        current_offset = offset
+        if cls._min_length == cls._max_length:
+            _len = cls._min_length
+        else:
+            _len, size = Uint.decode_from(buffer, current_offset)
+            current_offset += size
+        if cls._bulk_fmt is not None:
+            return current_offset + int(_len) * cls._element_type.byte_size - offset
+        for _ in range(_len):
+            current_offset += cls._element_type.decode_size_from(buffer, current_offset)
+        return current_offset - offset
+
+    @classmethod
+    def decode_parallel(
+        cls,
+        buffer: Union[bytes, bytearray, memoryview],
+        offset: int = 0,
+        max_workers: int = None,
+        chunk_elements: int = 8192,
+    ) -> Tuple["Seq", int]:
+        """
+        Decode a large homogeneous sequence across worker threads.
+
+        A skip pass (decode_size_from, or pure arithmetic for fixed-size
+        elements) finds chunk boundaries without materializing anything,
+        then each chunk decodes via decode_batch on its own thread and the
+        results are reassembled in order. Threads rather than processes:
+        parameterized classes are minted at runtime and don't pickle, and
+        the buffer stays shared instead of being copied per worker. The
+        win is largest when the chunk decode spends its time in struct or
+        the native varint kernel, which release the GIL.
+
+        Sequences at or below `chunk_elements` fall back to decode_from.
+        """
+        from concurrent.futures import ThreadPoolExecutor
+        from tsrkit_types.constants import MAX_SEQUENCE_LENGTH
+
+        current_offset = offset
+        if cls._min_length == cls._max_length:
+            _len = cls._min_length
+        else:
+            _len, size = Uint.decode_from(buffer, current_offset)
+            current_offset += size
+            if _len > MAX_SEQUENCE_LENGTH:
+                raise ValueError(
+                    f"Sequence length {_len} exceeds maximum {MAX_SEQUENCE_LENGTH}"
+                )
+        _len = int(_len)
+
+        if _len <= chunk_elements:
+            return cls.decode_from(buffer, offset)
+
+        elem_t = cls._element_type
+        chunks = []  # (payload offset, element count) per worker task
+        if cls._bulk_fmt is not None:
+            # Fixed-size elements: boundaries are pure arithmetic
+            byte_size = elem_t.byte_size
+            for start in range(0, _len, chunk_elements):
+                count = min(chunk_elements, _len - start)
+                chunks.append((current_offset + start * byte_size, count))
+            end_offset = current_offset + _len * byte_size
+        else:
+            skip = elem_t.decode_size_from
+            pos = current_offset
+            for i in range(_len):
+                if i % chunk_elements == 0:
+                    chunks.append((pos, min(chunk_elements, _len - i)))
+                pos += skip(buffer, pos)
+            end_offset = pos
+
+        # Decode-mode flags are thread-local; propagate them to the workers
+        trusted = trusted_enabled()
+        zero_copy = zero_copy_enabled()
+
+        def _decode_chunk(chunk):
+            _decode_flags.trusted = trusted
+            _decode_flags.zero_copy = zero_copy
+            start, count = chunk
+            return elem_t.decode_batch(buffer, count, start)[0]
+
+        with ThreadPoolExecutor(max_workers=max_workers) as executor:
+            parts = list(executor.map(_decode_chunk, chunks))
+
+        items = [item for part in parts for item in part]
+        if trusted:
+            result = list.__new__(cls)
+            list.__init__(result, items)
+            return result, end_offset - offset
+        return cls(items), end_offset - offset
+
+    # ---------------------------------------------------------------------------- #
+    #                               Indexed encoding                               #
+    # ---------------------------------------------------------------------------- #
+
+    def encode_indexed(self) -> bytes:
+        """
+        Encode with a per-element offset index for random access.
+
+        Layout: count (varint) | offset width (1 byte, 1/2/4/8) |
+        count+1 offsets (little-endian, relative to the payload start,
+        the last one being the payload length) | payload. Decode with
+        `decode_indexed`, which returns a lazy SeqView instead of
+        materializing every element.
+        """
+        writer = _acquire_writer()
+        try:
+            offsets = [0]
+            for item in self:
+                item.encode_to(writer)
+                offsets.append(writer.pos)
+            payload = writer.getvalue()
+        finally:
+            _release_writer(writer)
+
+        width = next(w for w in (1, 2, 4, 8) if len(payload) < 1 << (8 * w))
+        head = Uint(len(self)).encode() + bytes([width])
+        table = bytearray(len(offsets) * width)
+        struct.pack_into(f"<{len(offsets)}{_FIXED_INT_FMT[width]}", table, 0, *offsets)
+        return head + bytes(table) + payload
+
+    @classmethod
+    def decode_indexed(
+        cls, buffer: Union[bytes, bytearray, memoryview], offset: int = 0
+    ) -> Tuple["SeqView", int]:
+        """
+        Decode an `encode_indexed` buffer into a lazy SeqView.
+
+        Only the header and offset table are read; elements decode on
+        first access by index. Returns (view, total bytes occupied).
+        """
+        from tsrkit_types.constants import MAX_SEQUENCE_LENGTH
+
+        count, size = Uint.decode_from(buffer, offset)
+        count = int(count)
+        if count > MAX_SEQUENCE_LENGTH:
+            raise ValueError(
+                f"Sequence length {count} exceeds maximum {MAX_SEQUENCE_LENGTH}"
+            )
+        current_offset = offset + size
+        width = buffer[current_offset]
+        if width not in _FIXED_INT_FMT:
+            raise ValueError(f"Invalid offset width {width}; expected 1, 2, 4 or 8")
+        current_offset += 1
+        offsets = struct.unpack_from(f"<{count + 1}{_FIXED_INT_FMT[width]}", buffer, current_offset)
+        current_offset += (count + 1) * width
+        view = SeqView(cls, buffer, current_offset, offsets)
+        return view, current_offset + offsets[-1] - offset
+
     # ---------------------------------------------------------------------------- #
     #                                  JSON Serde                                  #
     # ---------------------------------------------------------------------------- #
@@ -198,6 +508,305 @@ class Seq(list, Codable, Generic[T], metaclass=SeqCheckMeta):
         return cls(items)
 
 
+class SeqView:
+    """
+    Lazy random-access view over an indexed Seq encoding.
+
+    Elements decode individually on first access using the offset table,
+    so point lookups into a large encoded sequence (including one backed
+    by a memory-mapped file) never decode their neighbours. Decoded
+    elements are cached by index; `materialize()` produces the fully
+    validated Seq instance.
+    """
+
+    __slots__ = ("_cls", "_buffer", "_payload_start", "_offsets", "_cache")
+
+    def __init__(self, seq_cls, buffer, payload_start: int, offsets: tuple):
+        self._cls = seq_cls
+        self._buffer = buffer
+        self._payload_start = payload_start
+        self._offsets = offsets
+        self._cache = {}
+
+    def __len__(self) -> int:
+        return len(self._offsets) - 1
+
+    def __getitem__(self, index):
+        if isinstance(index, slice):
+            return [self[i] for i in range(*index.indices(len(self)))]
+        if index < 0:
+            index += len(self)
+        if not 0 <= index < len(self):
+            raise IndexError("SeqView index out of range")
+        value = self._cache.get(index)
+        if value is None:
+            value, _ = self._cls._element_type.decode_from(
+                self._buffer, self._payload_start + self._offsets[index]
+            )
+            self._cache[index] = value
+        return value
+
+    def __iter__(self):
+        for i in range(len(self)):
+            yield self[i]
+
+    def __eq__(self, other):
+        if isinstance(other, (SeqView, list, tuple)):
+            return len(self) == len(other) and all(a == b for a, b in zip(self, other))
+        return NotImplemented
+
+    def __repr__(self):
+        return f"SeqView({self._cls.__name__}, {len(self)} elements)"
+
+    def materialize(self) -> "Seq":
+        """Decode every element and return the validated Seq instance."""
+        return self._cls(list(self))
+
+
+class RawSeq(Codable):
+    """
+    Sequence of fixed-size unsigned integers or Bool backed by an array
+    of unboxed machine values.
+
+    Where Seq holds one boxed object per element (28+ bytes for a small
+    int), RawSeq keeps the raw values in an `array` of the element's width
+    and boxes on access, so tens of millions of resident elements cost
+    element-width bytes each. encode/decode move the backing store with a
+    single buffer copy instead of a per-element loop.
+
+    Usage:
+        >>> counts = RawSeq[U32]([1, 2, 3])
+        >>> counts[1]
+        U32(2)
+        >>> matrix = RawSeq[Bool, 8]([True] * 8)
+    """
+
+    _element_type: ClassVar[Type]
+    _min_length: ClassVar[int] = 0
+    _max_length: ClassVar[int] = 2 ** 64
+    _typecode: ClassVar[str] = "B"
+    _is_bool: ClassVar[bool] = False
+
+    __slots__ = ("_data",)
+
+    def __class_getitem__(cls, params):
+        from tsrkit_types.bool import Bool
+
+        min_l, max_l = 0, 2 ** 64
+        if isinstance(params, type):
+            elem_t = params
+        elif isinstance(params, tuple) and len(params) == 2 and isinstance(params[0], type) and isinstance(params[1], int):
+            elem_t, min_l, max_l = params[0], params[1], params[1]
+        elif isinstance(params, tuple) and len(params) == 3 and isinstance(params[0], type):
+            elem_t, min_l, max_l = params
+        else:
+            raise TypeError(f"Invalid param to define {cls.__name__}: {params}")
+
+        is_bool = issubclass(elem_t, Bool)
+        if is_bool:
+            typecode = "B"
+        else:
+            typecode = None
+            if _bulk_int_format(elem_t) is not None:
+                typecode = _raw_typecode(elem_t.byte_size)
+            if typecode is None:
+                raise TypeError(
+                    f"{cls.__name__} requires a fixed-size unsigned integer or Bool "
+                    f"element type, got {elem_t!r}"
+                )
+
+        parts = [elem_t.__name__]
+        if min_l == max_l:
+            parts.append(f"N={min_l}")
+        else:
+            if min_l:
+                parts.append(f"min={min_l}")
+            if max_l != 2 ** 64:
+                parts.append(f"max={max_l}")
+        name = f"{cls.__name__}[{','.join(parts)}]"
+
+        cache_key = (cls, elem_t, min_l, max_l)
+        cached = _param_cache.get(cache_key)
+        if cached is not None:
+            return cached
+
+        new_cls = type(name, (cls,), {
+            "_element_type": elem_t,
+            "_min_length": min_l,
+            "_max_length": max_l,
+            "_typecode": typecode,
+            "_is_bool": is_bool,
+            "__slots__": (),
+        })
+        _param_cache[cache_key] = new_cls
+        return new_cls
+
+    def __init__(self, initial=()):
+        self._data = array(self._typecode)
+        self.extend(initial)
+
+    def _unbox(self, value) -> int:
+        """Raw machine value for storage; accepts boxed or plain values."""
+        if self._is_bool:
+            return 1 if value else 0
+        return int(value)
+
+    def _box(self, raw: int):
+        """Boxed element; raw values are range-exact for the element type."""
+        if self._is_bool:
+            return self._element_type(raw != 0)
+        return int.__new__(self._element_type, raw)
+
+    def _validate_self(self):
+        if len(self._data) < self._min_length:
+            raise ValueError(f"Vector: Expected sequence size to be >= {self._min_length}, resultant size {len(self._data)}")
+        elif len(self._data) > self._max_length:
+            raise ValueError(f"Vector: Expected sequence size to be <= {self._max_length}, resultant size {len(self._data)}")
+
+    def append(self, value):
+        try:
+            self._data.append(self._unbox(value))
+        except OverflowError as e:
+            raise ValueError(f"{type(self).__name__}: {value!r} out of range") from e
+        self._validate_self()
+
+    def extend(self, values):
+        try:
+            self._data.extend(self._unbox(v) for v in values)
+        except OverflowError as e:
+            raise ValueError(f"{type(self).__name__}: value out of range") from e
+        self._validate_self()
+
+    def tolist(self) -> list:
+        """Every element, boxed."""
+        return [self._box(v) for v in self._data]
+
+    def __len__(self) -> int:
+        return len(self._data)
+
+    def __getitem__(self, index):
+        if isinstance(index, slice):
+            return [self._box(v) for v in self._data[index]]
+        return self._box(self._data[index])
+
+    def __setitem__(self, index, value):
+        try:
+            self._data[index] = self._unbox(value)
+        except OverflowError as e:
+            raise ValueError(f"{type(self).__name__}: {value!r} out of range") from e
+
+    def __iter__(self):
+        box = self._box
+        return (box(v) for v in self._data)
+
+    def __eq__(self, other):
+        if isinstance(other, RawSeq):
+            return self._data == other._data
+        if isinstance(other, (list, tuple)):
+            if len(self._data) != len(other):
+                return False
+            unbox = self._unbox
+            return all(a == unbox(b) for a, b in zip(self._data, other))
+        return NotImplemented
+
+    def __repr__(self):
+        return f"{type(self).__name__}({list(self._data)})"
+
+    @property
+    def _length(self) -> Optional[int]:
+        if self._min_length == self._max_length:
+            return self._min_length
+        return None
+
+    # ---------------------------------------------------------------------------- #
+    #                                 Serialization                                #
+    # ---------------------------------------------------------------------------- #
+    def _raw_bytes(self):
+        """Backing store as wire bytes (little-endian); zero-copy where possible."""
+        if sys.byteorder == "little":
+            return memoryview(self._data).cast("B")
+        swapped = array(self._typecode, self._data)
+        swapped.byteswap()
+        return swapped.tobytes()
+
+    def encode_size(self) -> int:
+        size = 0
+        if self._length is None:
+            size += Uint(len(self._data)).encode_size()
+        return size + len(self._data) * self._data.itemsize
+
+    def encode_into(self, buffer: bytearray, offset: int = 0) -> int:
+        current_offset = offset
+        if self._min_length != self._max_length:
+            current_offset += Uint(len(self._data)).encode_into(buffer, current_offset)
+        raw = self._raw_bytes()
+        buffer[current_offset:current_offset + len(raw)] = raw
+        return current_offset + len(raw) - offset
+
+    def encode_to(self, writer) -> None:
+        if self._min_length != self._max_length:
+            Uint(len(self._data)).encode_to(writer)
+        writer.write(self._raw_bytes())
+
+    @classmethod
+    def decode_from(cls, buffer: Union[bytes, bytearray, memoryview], offset: int = 0) -> Tuple["RawSeq", int]:
+        from tsrkit_types.constants import MAX_SEQUENCE_LENGTH
+
+        current_offset = offset
+        if cls._min_length == cls._max_length:
+            _len = cls._min_length
+        else:
+            _len, size = Uint.decode_from(buffer, current_offset)
+            current_offset += size
+            if _len > MAX_SEQUENCE_LENGTH:
+                raise ValueError(
+                    f"Sequence length {_len} exceeds maximum {MAX_SEQUENCE_LENGTH}"
+                )
+            if not cls._min_length <= _len <= cls._max_length:
+                raise ValueError(
+                    f"Vector: Expected sequence size in [{cls._min_length}, {cls._max_length}], got {_len}"
+                )
+
+        data = array(cls._typecode)
+        nbytes = int(_len) * data.itemsize
+        if len(buffer) - current_offset < nbytes:
+            raise ValueError(
+                f"Buffer too small: need {nbytes} bytes at offset {current_offset}, "
+                f"but buffer has only {len(buffer)} bytes"
+            )
+        # One memcpy-like transfer into the backing store
+        data.frombytes(memoryview(buffer)[current_offset:current_offset + nbytes])
+        if sys.byteorder != "little":
+            data.byteswap()
+
+        result = cls.__new__(cls)
+        result._data = data
+        return result, current_offset + nbytes - offset
+
+    @classmethod
+    def decode_size_from(cls, buffer: Union[bytes, bytearray, memoryview], offset: int = 0) -> int:
+        """Skip length of the encoding at `offset` without copying the payload."""
+        item_size = array(cls._typecode).itemsize
+        if cls._min_length == cls._max_length:
+            return cls._min_length * item_size
+        _len, size = Uint.decode_from(buffer, offset)
+        return size + int(_len) * item_size
+
+    # ---------------------------------------------------------------------------- #
+    #                                  JSON Serde                                  #
+    # ---------------------------------------------------------------------------- #
+    def to_json(self):
+        """Convert to JSON representation."""
+        if self._is_bool:
+            return [bool(v) for v in self._data]
+        return list(self._data)
+
+    @classmethod
+    def from_json(cls, data):
+        """Create instance from JSON representation."""
+        return cls(data)
+
+
 # All params supported-
 # Union[Type, int, Tuple[Type, int], Tuple[int, int], Tuple[Type, int, int]]
 
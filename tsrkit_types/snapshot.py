@@ -0,0 +1,92 @@
+"""
+Memory-mapped reader for files of encoded values.
+
+Loading persisted state with open().read() materializes the whole file on
+the heap before a single record decodes. This module maps the file instead
+and serves decoding straight off the mapping: the OS pages bytes in on
+access, restart cost is proportional to what is touched, and RSS never
+doubles. Combined with zero-copy decode mode, Bytes payloads stay views
+into the mapping until someone actually freezes or copies them.
+
+Usage:
+    >>> with SnapshotReader("state.bin") as snap:
+    ...     header = snap.decode(Header)                 # one record
+    ...     for record in snap.records(Record, offset=header_size):
+    ...         handle(record)                           # sequential scan
+    ...     view = snap.view_indexed(History)            # random access
+    ...     view[50_000]
+"""
+
+import mmap
+from typing import Iterator, Tuple
+
+from tsrkit_types.itf.codable import zero_copy_decode
+
+
+class SnapshotReader:
+    """
+    Wraps an encoded file in a read-only mmap and decodes off the mapping.
+
+    Decoding happens in zero-copy mode by default, so types that support
+    it (notably Bytes) return views into the mapping instead of heap
+    copies. Such views are only valid while the reader is open — freeze()
+    or copy anything that must outlive it.
+    """
+
+    def __init__(self, path, zero_copy: bool = True):
+        self._file = open(path, "rb")
+        self._map = mmap.mmap(self._file.fileno(), 0, access=mmap.ACCESS_READ)
+        self._view = memoryview(self._map)
+        self._zero_copy = zero_copy
+
+    @property
+    def buffer(self) -> memoryview:
+        """The mapped file as a memoryview."""
+        return self._view
+
+    def __len__(self) -> int:
+        return len(self._view)
+
+    def decode_from(self, type_, offset: int = 0) -> Tuple[object, int]:
+        """Decode one value at `offset`; returns (value, bytes read)."""
+        if self._zero_copy:
+            with zero_copy_decode():
+                return type_.decode_from(self._view, offset)
+        return type_.decode_from(self._view, offset)
+
+    def decode(self, type_, offset: int = 0):
+        """Decode one value at `offset` and return it."""
+        value, _ = self.decode_from(type_, offset)
+        return value
+
+    def records(self, type_, offset: int = 0) -> Iterator:
+        """Yield consecutive values of one type until the end of the file."""
+        current_offset = offset
+        end = len(self._view)
+        while current_offset < end:
+            value, size = self.decode_from(type_, current_offset)
+            current_offset += size
+            yield value
+
+    def view_indexed(self, seq_cls, offset: int = 0):
+        """
+        Lazy SeqView over an `encode_indexed` sequence in the file.
+
+        Elements decode individually off the mapping on first access —
+        a point lookup into a multi-gigabyte snapshot touches only the
+        offset table and that element's pages.
+        """
+        view, _ = seq_cls.decode_indexed(self._view, offset)
+        return view
+
+    def close(self) -> None:
+        """Release the mapping; outstanding views into it become invalid."""
+        self._view.release()
+        self._map.close()
+        self._file.close()
+
+    def __enter__(self) -> "SnapshotReader":
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback) -> None:
+        self.close()
@@ -0,0 +1,226 @@
+"""
+Streaming frame codec for sockets and files.
+
+Everything else in the library assumes a complete in-memory buffer; this
+module adds an incremental layer on top. Values are framed with a general
+Uint length prefix, so a reader can suspend mid-prefix or mid-payload when
+bytes run out and resume when more arrive — without ever holding more than
+one frame in memory.
+
+Usage:
+    >>> writer = FrameWriter(sock_file)
+    >>> writer.write(record)            # length-prefixed, chunked flush
+    >>>
+    >>> reader = FrameReader(Record, stream=sock_file)
+    >>> for record in reader:           # pull mode: reads in chunks
+    ...     handle(record)
+    >>>
+    >>> reader = FrameReader(Record)    # push mode: feed bytes as they arrive
+    >>> reader.feed(packet)
+    >>> while (record := reader.read()) is not None:
+    ...     handle(record)
+
+The async functions at the bottom speak the same frame format over
+asyncio streams:
+
+    >>> await encode_stream(stream_writer, record)
+    >>> record = await decode_stream(stream_reader, Record)
+"""
+
+import asyncio
+from typing import Iterator, Optional, Union
+
+from tsrkit_types.integers import Uint
+from tsrkit_types.itf.codable import BufWriter
+
+_DEFAULT_CHUNK_SIZE = 64 * 1024
+_DEFAULT_MAX_FRAME_SIZE = 1 << 32
+
+
+class FrameWriter:
+    """
+    Writes length-prefixed encoded values to a binary stream.
+
+    Each value is encoded once (via the single-pass writer path) and
+    flushed in chunks, so multi-megabyte payloads never require the
+    stream to accept one giant write.
+    """
+
+    def __init__(self, stream, chunk_size: int = _DEFAULT_CHUNK_SIZE):
+        self._stream = stream
+        self._chunk_size = chunk_size
+
+    def write(self, value) -> int:
+        """Encode `value` as one frame; returns total bytes written."""
+        body = BufWriter()
+        value.encode_to(body)
+        header = Uint(body.pos).encode()
+
+        self._stream.write(header)
+        payload = memoryview(body.buf)[: body.pos]
+        for start in range(0, len(payload), self._chunk_size):
+            self._stream.write(payload[start : start + self._chunk_size])
+        return len(header) + len(payload)
+
+    def flush(self) -> None:
+        if hasattr(self._stream, "flush"):
+            self._stream.flush()
+
+
+class FrameReader:
+    """
+    Incrementally decodes length-prefixed values of a single type.
+
+    Operates in two modes:
+      - pull: constructed with a `stream`, iterating reads chunks from it;
+      - push: `feed()` bytes as they arrive (e.g. from a socket) and drain
+        completed frames with `read()`.
+
+    Partial input suspends cleanly: a frame whose length prefix or payload
+    is incomplete stays buffered until more bytes are fed.
+    """
+
+    def __init__(
+        self,
+        frame_type,
+        stream=None,
+        chunk_size: int = _DEFAULT_CHUNK_SIZE,
+        max_frame_size: int = _DEFAULT_MAX_FRAME_SIZE,
+    ):
+        self._frame_type = frame_type
+        self._stream = stream
+        self._chunk_size = chunk_size
+        self._max_frame_size = max_frame_size
+        self._buf = bytearray()
+        self._pos = 0
+
+    def feed(self, data: Union[bytes, bytearray, memoryview]) -> None:
+        """Append raw bytes received from the transport."""
+        self._buf += data
+
+    def _compact(self) -> None:
+        """Drop consumed bytes so the buffer never grows past one frame."""
+        if self._pos:
+            del self._buf[: self._pos]
+            self._pos = 0
+
+    def _pending_frame(self) -> Optional[int]:
+        """Payload length if a complete frame is buffered, else None."""
+        available = len(self._buf) - self._pos
+        if available < 1:
+            return None
+        # Length of the varint prefix itself is known from its first byte
+        prefix_size = Uint.decode_size_from(self._buf, self._pos)
+        if available < prefix_size:
+            return None  # suspended mid-varint
+        frame_len, _ = Uint.decode_from(self._buf, self._pos)
+        frame_len = int(frame_len)
+        if frame_len > self._max_frame_size:
+            raise ValueError(
+                f"Frame length {frame_len} exceeds maximum {self._max_frame_size}"
+            )
+        if available < prefix_size + frame_len:
+            return None  # suspended mid-payload
+        return frame_len
+
+    def read(self):
+        """
+        Decode and return the next buffered value, or None if no complete
+        frame is available yet.
+        """
+        frame_len = self._pending_frame()
+        if frame_len is None:
+            return None
+        self._pos += Uint.decode_size_from(self._buf, self._pos)
+        value, _ = self._frame_type.decode_from(self._buf, self._pos)
+        self._pos += frame_len
+        self._compact()
+        return value
+
+    def __iter__(self) -> Iterator:
+        """
+        Yield decoded values; in pull mode, keeps reading stream chunks
+        until the stream is exhausted.
+        """
+        while True:
+            value = self.read()
+            if value is not None:
+                yield value
+                continue
+            if self._stream is None:
+                return
+            chunk = self._stream.read(self._chunk_size)
+            if not chunk:
+                if len(self._buf) - self._pos > 0:
+                    raise ValueError("Stream ended mid-frame")
+                return
+            self.feed(chunk)
+
+# ---------------------------------------------------------------------------- #
+#                                Asyncio layer                                 #
+# ---------------------------------------------------------------------------- #
+
+async def encode_stream(writer, value, chunk_size: int = _DEFAULT_CHUNK_SIZE) -> int:
+    """
+    Write one framed value to an asyncio StreamWriter.
+
+    The payload is handed to the transport in chunks with a drain() await
+    between them, so a slow peer applies back-pressure instead of the
+    whole encoding piling up in the transport buffer. Returns total bytes
+    written.
+    """
+    body = BufWriter()
+    value.encode_to(body)
+    header = Uint(body.pos).encode()
+
+    writer.write(header)
+    payload = memoryview(body.buf)[: body.pos]
+    for start in range(0, len(payload), chunk_size):
+        writer.write(bytes(payload[start : start + chunk_size]))
+        await writer.drain()
+    return len(header) + len(payload)
+
+
+async def decode_stream(
+    reader, frame_type, max_frame_size: int = _DEFAULT_MAX_FRAME_SIZE
+):
+    """
+    Read one framed value from an asyncio StreamReader.
+
+    Awaits exactly the bytes each part needs: one byte to size the varint
+    prefix, the rest of the prefix, then the payload — no speculative
+    buffering on top of the stream's own. Returns None on a clean EOF
+    (stream closed between frames); a stream that ends mid-frame raises
+    asyncio.IncompleteReadError.
+    """
+    try:
+        first = await reader.readexactly(1)
+    except asyncio.IncompleteReadError as exc:
+        if exc.partial:
+            raise
+        return None
+
+    prefix_size = Uint.decode_size_from(first, 0)
+    prefix = first
+    if prefix_size > 1:
+        prefix += await reader.readexactly(prefix_size - 1)
+    frame_len = int(Uint.decode_from(prefix, 0)[0])
+    if frame_len > max_frame_size:
+        raise ValueError(
+            f"Frame length {frame_len} exceeds maximum {max_frame_size}"
+        )
+
+    payload = await reader.readexactly(frame_len)
+    value, _ = frame_type.decode_from(payload, 0)
+    return value
+
+
+async def iter_stream(
+    reader, frame_type, max_frame_size: int = _DEFAULT_MAX_FRAME_SIZE
+):
+    """Yield framed values from an asyncio StreamReader until clean EOF."""
+    while True:
+        value = await decode_stream(reader, frame_type, max_frame_size)
+        if value is None:
+            return
+        yield value
@@ -26,20 +26,29 @@ class String(str, Codable):
     # ---------------------------------------------------------------------------- #
     #                                 Serialization                                #
     # ---------------------------------------------------------------------------- #
+    def _utf8(self) -> bytes:
+        """UTF-8 bytes, converted once — String is immutable so the cache never invalidates."""
+        cached = self.__dict__.get("_utf8_bytes")
+        if cached is None:
+            cached = str(self).encode("utf-8")
+            self.__dict__["_utf8_bytes"] = cached
+            self.__dict__["_prefix_size"] = Uint(len(cached)).encode_size()
+        return cached
+
     def encode(self) -> bytes:
-        utf8_bytes = str(self).encode("utf-8")
-        buffer = bytearray(Uint(len(utf8_bytes)).encode_size() + len(utf8_bytes))
+        utf8_bytes = self._utf8()
+        buffer = bytearray(self.__dict__["_prefix_size"] + len(utf8_bytes))
         offset = Uint(len(utf8_bytes)).encode_into(buffer, 0)
         buffer[offset:offset + len(utf8_bytes)] = utf8_bytes
-        return buffer
-    
+        return bytes(buffer)
+
     def encode_size(self) -> int:
-        utf8_bytes = str(self).encode("utf-8")
-        return Uint(len(utf8_bytes)).encode_size() + len(utf8_bytes)
-    
+        utf8_bytes = self._utf8()
+        return self.__dict__["_prefix_size"] + len(utf8_bytes)
+
     def encode_into(self, buffer: bytearray, offset: int = 0) -> int:
         current_offset = offset
-        utf8_bytes = str(self).encode("utf-8")
+        utf8_bytes = self._utf8()
         current_offset += Uint(len(utf8_bytes)).encode_into(buffer, current_offset)
         buffer[current_offset:current_offset + len(utf8_bytes)] = utf8_bytes
         return current_offset + len(utf8_bytes) - offset
@@ -65,7 +74,8 @@ class String(str, Codable):
                 f"have {len(buffer) - current_offset} bytes"
             )
 
-        utf8_bytes = buffer[current_offset:current_offset + byte_len]
+        # bytes() also normalizes memoryview input (e.g. an mmap-backed buffer)
+        utf8_bytes = bytes(buffer[current_offset:current_offset + byte_len])
 
         # Security: Handle invalid UTF-8 with clear error message
         try:
@@ -81,6 +91,12 @@ class String(str, Codable):
     def decode(cls, buffer: Union[bytes, bytearray, memoryview], offset: int = 0) -> Tuple["String", int]:
         value, bytes_read = cls.decode_from(buffer, offset)
         return value
+
+    @classmethod
+    def decode_size_from(cls, buffer: Union[bytes, bytearray, memoryview], offset: int = 0) -> int:
+        """Skip length of the encoding at `offset` without decoding the UTF-8 payload."""
+        byte_len, size = Uint.decode_from(buffer, offset)
+        return size + int(byte_len)
     
     # ---------------------------------------------------------------------------- #
     #                                  JSON Serde                                  #
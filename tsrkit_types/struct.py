@@ -1,13 +1,269 @@
+import struct as _struct
 from dataclasses import dataclass, fields
 from typing import Any, Tuple, Union, dataclass_transform
-from tsrkit_types.itf.codable import Codable
+from tsrkit_types.itf.codable import Codable, _decode_flags
 from tsrkit_types.null import NullType
 from tsrkit_types.option import Option
 
+# Fixed-size unsigned int byte sizes with a struct format char
+_FIXED_INT_FMT = {1: "B", 2: "H", 4: "I", 8: "Q"}
+
+
+def _create_fn(name, args, body, globals_ns):
+    """Compile a function from source, the way dataclasses builds __init__.
+
+    Field names and types are baked into the generated source so the codec
+    methods are a flat run of attribute accesses and codec calls instead of
+    a per-call `dataclasses.fields()` loop.
+    """
+    src = f"def {name}({', '.join(args)}):\n" + "\n".join(f"    {line}" for line in body)
+    ns = {}
+    exec(src, globals_ns, ns)
+    return ns[name]
+
+
+def _fixed_layout(field_list):
+    """
+    Classify a struct as fixed-layout if every field has a compile-time
+    constant encoding size: fixed unsigned ints, Bool and Bytes[N].
+
+    Returns (struct.Struct, [(name, kind)]) for the fused format, or None
+    when any field is variable-size (or a fixed type struct can't express,
+    e.g. signed ints or nested containers).
+    """
+    from tsrkit_types.bool import Bool
+    from tsrkit_types.bytes import Bytes
+    from tsrkit_types.integers import Int
+
+    fmt = "<"
+    specs = []
+    for f in field_list:
+        t = f.type
+        if not isinstance(t, type):
+            return None
+        if issubclass(t, Bool):
+            fmt += "B"
+            specs.append((f.name, "bool"))
+        elif issubclass(t, Int):
+            if t.signed or t.byte_size not in _FIXED_INT_FMT:
+                return None
+            fmt += _FIXED_INT_FMT[t.byte_size]
+            specs.append((f.name, "int"))
+        elif issubclass(t, Bytes):
+            if t._length is None:
+                return None
+            fmt += f"{t._length}s"
+            specs.append((f.name, "bytes"))
+        else:
+            return None
+    if not specs:
+        return None
+    return _struct.Struct(fmt), specs
+
+
+def _construction_lines(field_list, value_exprs, direct, indent=""):
+    """
+    Source lines building `instance` from per-field value expressions.
+
+    With `direct`, the instance comes from the active Arena when one is
+    installed on the thread, otherwise from object.__new__, and fields are
+    assigned via object.__setattr__ — no kwargs dict, no __init__
+    re-validation, and it works for frozen and __slots__ classes alike.
+    Callers must emit the `_arena = ...` lookup before these lines.
+    Otherwise the class is called with keyword arguments as before.
+    """
+    if direct:
+        lines = [f"{indent}instance = _new(cls) if _arena is None else _arena.take(cls)"]
+        for f, expr in zip(field_list, value_exprs):
+            lines.append(f"{indent}_setattr(instance, {f.name!r}, {expr})")
+        return lines
+    kwargs = ", ".join(f"{f.name}={expr}" for f, expr in zip(field_list, value_exprs))
+    return [f"{indent}instance = cls({kwargs})"]
+
+
+def _make_fixed_codec_fns(field_list, layout, direct):
+    """Generate constant-size codec methods around one fused struct.Struct."""
+    fused, specs = layout
+    size = fused.size
+    globals_ns = {f"_type_{f.name}": f.type for f in field_list}
+    globals_ns["_pack_into"] = fused.pack_into
+    globals_ns["_unpack_from"] = fused.unpack_from
+    globals_ns["_new"] = object.__new__
+    globals_ns["_setattr"] = object.__setattr__
+    globals_ns["_flags"] = _decode_flags
+
+    encode_size = _create_fn("encode_size", ["self"], [f"return {size}"], globals_ns)
+
+    pack_args = []
+    for name, kind in specs:
+        if kind == "bool":
+            pack_args.append(f"(1 if self.{name} else 0)")
+        elif kind == "bytes":
+            pack_args.append(f"bytes(self.{name})")
+        else:
+            pack_args.append(f"self.{name}")
+    enc_body = [
+        f"_pack_into(buffer, offset, {', '.join(pack_args)})",
+        f"return {size}",
+    ]
+    encode_into = _create_fn("encode_into", ["self", "buffer", "offset=0"], enc_body, globals_ns)
+
+    to_body = [
+        f"writer.reserve({size})",
+        f"_pack_into(writer.buf, writer.pos, {', '.join(pack_args)})",
+        f"writer.pos += {size}",
+    ]
+    encode_to = _create_fn("encode_to", ["self", "writer"], to_body, globals_ns)
+
+    names = ", ".join(f"_v_{name}" for name, _ in specs)
+    unpack_exprs = []
+    for name, kind in specs:
+        if kind == "bool":
+            unpack_exprs.append(f"_type_{name}(_v_{name} != 0)")
+        elif kind == "bytes":
+            unpack_exprs.append(f"_type_{name}(_v_{name})")
+        else:
+            # Unpacked values are exactly in the field's range; skip Int.__new__
+            unpack_exprs.append(f"int.__new__(_type_{name}, _v_{name})")
+    dec_body = [
+        f"({names},) = _unpack_from(buffer, offset)" if len(specs) == 1
+        else f"{names} = _unpack_from(buffer, offset)",
+    ]
+    if direct:
+        dec_body.append("_arena = getattr(_flags, 'arena', None)")
+    dec_body.extend(_construction_lines(field_list, unpack_exprs, direct))
+    dec_body.append(f"return instance, {size}")
+    decode_from = classmethod(
+        _create_fn("decode_from", ["cls", "buffer", "offset=0"], dec_body, globals_ns)
+    )
+
+    decode_size_from = classmethod(
+        _create_fn("decode_size_from", ["cls", "buffer", "offset=0"], [f"return {size}"], globals_ns)
+    )
+
+    # Batch codec: one iter_unpack / pack_into loop over the whole run
+    globals_ns["_iter_unpack"] = fused.iter_unpack
+    batch_dec_body = [
+        f"end = offset + count * {size}",
+        "view = memoryview(buffer)[offset:end]",
+        "results = []",
+        "append = results.append",
+    ]
+    if direct:
+        batch_dec_body.append("_arena = getattr(_flags, 'arena', None)")
+    batch_dec_body.append(
+        f"for ({names},) in _iter_unpack(view):" if len(specs) == 1
+        else f"for ({names}) in _iter_unpack(view):"
+    )
+    batch_dec_body.extend(_construction_lines(field_list, unpack_exprs, direct, indent="    "))
+    batch_dec_body.append("    append(instance)")
+    batch_dec_body.append(f"return results, count * {size}")
+    decode_batch = classmethod(
+        _create_fn("decode_batch", ["cls", "buffer", "count", "offset=0"], batch_dec_body, globals_ns)
+    )
+
+    batch_enc_body = [
+        "values = list(values)",
+        "if buffer is None:",
+        f"    buffer = bytearray({size} * len(values))",
+        "    current_offset = 0",
+        "    for self in values:",
+        f"        _pack_into(buffer, current_offset, {', '.join(pack_args)})",
+        f"        current_offset += {size}",
+        "    return bytes(buffer)",
+        "current_offset = offset",
+        "for self in values:",
+        f"    _pack_into(buffer, current_offset, {', '.join(pack_args)})",
+        f"    current_offset += {size}",
+        "return current_offset - offset",
+    ]
+    encode_batch = classmethod(
+        _create_fn("encode_batch", ["cls", "values", "buffer=None", "offset=0"], batch_enc_body, globals_ns)
+    )
+
+    return encode_size, encode_into, encode_to, decode_from, decode_size_from, encode_batch, decode_batch
+
+
+def _make_codec_fns(field_list, direct):
+    """Generate specialized encode_size/encode_into/decode_from for a struct."""
+    globals_ns = {f"_type_{f.name}": f.type for f in field_list}
+    globals_ns["_new"] = object.__new__
+    globals_ns["_setattr"] = object.__setattr__
+    globals_ns["_flags"] = _decode_flags
+
+    size_body = ["return (" + " + ".join(
+        f"self.{f.name}.encode_size()" for f in field_list
+    ) + ")"] if field_list else ["return 0"]
+    encode_size = _create_fn("encode_size", ["self"], size_body, globals_ns)
+
+    enc_body = ["current_offset = offset"]
+    for f in field_list:
+        enc_body.append(f"current_offset += self.{f.name}.encode_into(buffer, current_offset)")
+    enc_body.append("return current_offset - offset")
+    encode_into = _create_fn("encode_into", ["self", "buffer", "offset=0"], enc_body, globals_ns)
+
+    to_body = [f"self.{f.name}.encode_to(writer)" for f in field_list] or ["pass"]
+    encode_to = _create_fn("encode_to", ["self", "writer"], to_body, globals_ns)
+
+    dec_body = ["current_offset = offset"]
+    for f in field_list:
+        dec_body.append(f"_v_{f.name}, _size = _type_{f.name}.decode_from(buffer, current_offset)")
+        dec_body.append("current_offset += _size")
+    if direct:
+        dec_body.append("_arena = getattr(_flags, 'arena', None)")
+    dec_body.extend(_construction_lines(field_list, [f"_v_{f.name}" for f in field_list], direct))
+    dec_body.append("return instance, current_offset - offset")
+    decode_from = classmethod(
+        _create_fn("decode_from", ["cls", "buffer", "offset=0"], dec_body, globals_ns)
+    )
+
+    size_from_body = ["current_offset = offset"]
+    for f in field_list:
+        size_from_body.append(
+            f"current_offset += _type_{f.name}.decode_size_from(buffer, current_offset)"
+        )
+    size_from_body.append("return current_offset - offset")
+    decode_size_from = classmethod(
+        _create_fn("decode_size_from", ["cls", "buffer", "offset=0"], size_from_body, globals_ns)
+    )
+
+    lazy_body = ["current_offset = offset", "_offsets = {}"]
+    for f in field_list:
+        lazy_body.append(f"_offsets[{f.name!r}] = current_offset")
+        lazy_body.append(
+            f"current_offset += _type_{f.name}.decode_size_from(buffer, current_offset)"
+        )
+    lazy_body.extend([
+        "instance = object.__new__(cls)",
+        "object.__setattr__(instance, '_lazy_buffer', buffer)",
+        "object.__setattr__(instance, '_lazy_offsets', _offsets)",
+        "return instance, current_offset - offset",
+    ])
+    decode_lazy = classmethod(
+        _create_fn("decode_lazy", ["cls", "buffer", "offset=0"], lazy_body, globals_ns)
+    )
+
+    return encode_size, encode_into, encode_to, decode_from, decode_size_from, decode_lazy
+
+
+def _lazy_getattr(self, name):
+    """Decode a lazily-skipped field on first access and cache the result."""
+    try:
+        offsets = object.__getattribute__(self, "_lazy_offsets")
+    except AttributeError:
+        raise AttributeError(name) from None
+    field_type = type(self)._field_types.get(name)
+    if field_type is None or name not in offsets:
+        raise AttributeError(name)
+    buffer = object.__getattribute__(self, "_lazy_buffer")
+    value, _ = field_type.decode_from(buffer, offsets[name])
+    object.__setattr__(self, name, value)
+    return value
+
 
 @dataclass_transform()
-def structure(_cls=None, *, frozen=False, **kwargs):
-    """Extension of dataclass to support serialization and json operations. 
+def structure(_cls=None, *, frozen=False, slots=False, **kwargs):
+    """Extension of dataclass to support serialization and json operations.
 
     Usage:
         >>> @structure
@@ -15,9 +271,14 @@ def structure(_cls=None, *, frozen=False, **kwargs):
         >>>     name: String = field(metadata={"name": "first_name"})
         >>>     age: Uint[8] = field(metadata={"default": 0})
 
+    With `slots=True` instances use `__slots__` instead of a per-instance
+    `__dict__`, which matters when millions of decoded records stay
+    resident. Lazy decoding still works (the slots include the two lazy
+    bookkeeping attributes), but ad-hoc attributes can no longer be added
+    to instances.
     """
     def wrap(cls):
-        new_cls = dataclass(cls, frozen=frozen, **kwargs)
+        new_cls = dataclass(cls, frozen=frozen, slots=slots, **kwargs)
 
         orig_init = new_cls.__init__
 
@@ -28,30 +289,24 @@ def structure(_cls=None, *, frozen=False, **kwargs):
                     kwargs[field.name] = field.metadata.get("default")
             orig_init(self, *args, **kwargs)
 
-        def encode_size(self) -> int:
-            return sum(getattr(self, field.name).encode_size() for field in fields(self))
+        # Specialized per-class codec methods compiled at decoration time.
+        # Decoded fields are typed and ordered by construction, so unless
+        # the class hooks __post_init__ the decode paths assemble instances
+        # directly instead of re-validating through __init__.
+        direct = not hasattr(new_cls, "__post_init__")
+        encode_size, encode_into, encode_to, decode_from, decode_size_from, decode_lazy = (
+            _make_codec_fns(fields(new_cls), direct)
+        )
+
+        # All-fixed-size structs get a fused struct.Struct codec instead:
+        # constant encode_size and a single pack/unpack per value
+        layout = _fixed_layout(fields(new_cls))
+        encode_batch = decode_batch = None
+        if layout is not None:
+            (encode_size, encode_into, encode_to, decode_from, decode_size_from,
+             encode_batch, decode_batch) = _make_fixed_codec_fns(fields(new_cls), layout, direct)
 
-        def encode_into(self, buffer: bytes, offset = 0) -> int:
-            current_offset = offset
-            for field in fields(self):
-                item = getattr(self, field.name)
-                size = item.encode_into(buffer, current_offset)
-                current_offset += size
 
-            return current_offset - offset
-            
-        @classmethod
-        def decode_from(cls, buffer: Union[bytes, bytearray, memoryview], offset: int = 0) -> Tuple[Any, int]:
-            current_offset = offset
-            decoded_values = {}
-            for field in fields(cls): 
-                field_type = field.type
-                value, size = field_type.decode_from(buffer, current_offset)
-                decoded_values[field.name] = value
-                current_offset += size
-            instance = cls(**decoded_values)
-            return instance, current_offset - offset
-        
         def to_json(self) -> dict:
             return {field.metadata.get("name", field.name): getattr(self, field.name).to_json() for field in fields(self)}
         
@@ -76,12 +331,35 @@ def structure(_cls=None, *, frozen=False, **kwargs):
             new_cls.decode_from = decode_from
         if not new_cls.__dict__.get("encode_into"):
             new_cls.encode_into = encode_into
+        if not new_cls.__dict__.get("encode_to"):
+            new_cls.encode_to = encode_to
         if not new_cls.__dict__.get("to_json"):
             new_cls.to_json = to_json
         if not new_cls.__dict__.get("from_json"):
             new_cls.from_json = from_json
+        if not new_cls.__dict__.get("decode_size_from"):
+            new_cls.decode_size_from = decode_size_from
+        if not new_cls.__dict__.get("decode_lazy"):
+            new_cls.decode_lazy = decode_lazy
+        if encode_batch is not None and not new_cls.__dict__.get("encode_batch"):
+            new_cls.encode_batch = encode_batch
+        if decode_batch is not None and not new_cls.__dict__.get("decode_batch"):
+            new_cls.decode_batch = decode_batch
+        if not new_cls.__dict__.get("__getattr__"):
+            new_cls.__getattr__ = _lazy_getattr
+        new_cls._field_types = {f.name: f.type for f in fields(new_cls)}
 
-        new_cls = type(new_cls.__name__, (Codable, new_cls), dict(new_cls.__dict__))
+        cls_dict = dict(new_cls.__dict__)
+        if slots:
+            # Field slots already live on new_cls, which stays a base of the
+            # rebuilt class; copying its member descriptors (or __slots__)
+            # into the subclass dict would allocate a duplicate set of slots.
+            # The rebuilt class only adds the lazy-decode bookkeeping slots.
+            cls_dict.pop("__slots__", None)
+            for f in fields(new_cls):
+                cls_dict.pop(f.name, None)
+            cls_dict["__slots__"] = ("_lazy_buffer", "_lazy_offsets")
+        new_cls = type(new_cls.__name__, (Codable, new_cls), cls_dict)
 
         return new_cls
 